@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace bench {
+static constexpr int kSeed = 42;
+
+// Generates a random hypergraph with num_hypernodes vertices and
+// num_hyperedges nets. Net sizes are uniformly distributed in
+// [2, max_net_size] and no net contains a vertex twice. The same parameters
+// always yield the same hypergraph.
+static inline std::unique_ptr<Hypergraph> randomHypergraph(const HypernodeID num_hypernodes,
+                                                           const HyperedgeID num_hyperedges,
+                                                           const HypernodeID max_net_size,
+                                                           const PartitionID k = 2) {
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<HypernodeID> hn_dist(0, num_hypernodes - 1);
+  std::uniform_int_distribution<HypernodeID> size_dist(2, std::max(2U, max_net_size));
+
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  index_vector.reserve(num_hyperedges + 1);
+  index_vector.push_back(0);
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    const size_t first_pin = edge_vector.size();
+    const HypernodeID size = std::min(size_dist(gen), num_hypernodes);
+    while (edge_vector.size() - first_pin < size) {
+      const HypernodeID pin = hn_dist(gen);
+      if (std::find(edge_vector.begin() + first_pin, edge_vector.end(), pin) == edge_vector.end()) {
+        edge_vector.push_back(pin);
+      }
+    }
+    index_vector.push_back(edge_vector.size());
+  }
+  return std::make_unique<Hypergraph>(num_hypernodes, num_hyperedges,
+                                      index_vector, edge_vector, k);
+}
+
+// Assigns every hypernode of the hypergraph to a random block.
+static inline void randomPartition(Hypergraph& hypergraph) {
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<PartitionID> part_dist(0, hypergraph.k() - 1);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, part_dist(gen));
+  }
+  hypergraph.initializeNumCutHyperedges();
+}
+
+// Contracts random pairs of adjacent hypernodes until only
+// target_num_hypernodes remain and returns the contraction history.
+static inline std::vector<Hypergraph::Memento> randomContractions(Hypergraph& hypergraph,
+                                                                  const HypernodeID target_num_hypernodes) {
+  std::mt19937 gen(kSeed);
+  std::vector<HypernodeID> nodes;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    nodes.push_back(hn);
+  }
+  std::shuffle(nodes.begin(), nodes.end(), gen);
+
+  std::vector<Hypergraph::Memento> history;
+  for (const HypernodeID& u : nodes) {
+    if (hypergraph.currentNumNodes() <= target_num_hypernodes) {
+      break;
+    }
+    if (!hypergraph.nodeIsEnabled(u)) {
+      continue;
+    }
+    for (const HyperedgeID& he : hypergraph.incidentEdges(u)) {
+      HypernodeID v = u;
+      for (const HypernodeID& pin : hypergraph.pins(he)) {
+        if (pin != u) {
+          v = pin;
+          break;
+        }
+      }
+      if (v != u) {
+        history.push_back(hypergraph.contract(u, v));
+        break;
+      }
+    }
+  }
+  return history;
+}
+}  // namespace bench
+}  // namespace kahypar
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "kahypar/datastructure/flat_hash_map.h"
+#include "kahypar/datastructure/hash_table.h"
+#include "kahypar/datastructure/sparse_map.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace ds {
+using RatingSparseMap = SparseMap<HypernodeID, RatingType>;
+using RatingFlatHashMap = FlatHashMap<HypernodeID, RatingType>;
+using RatingHashMap = HashMap<HypernodeID, RatingType>;
+
+static std::vector<HypernodeID> randomKeys(const size_t num_keys, const HypernodeID universe,
+                                           const int seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<HypernodeID> key_dist(0, universe - 1);
+  std::vector<HypernodeID> keys(num_keys);
+  for (HypernodeID& key : keys) {
+    key = key_dist(gen);
+  }
+  return keys;
+}
+
+// Simulates the rating of vertices: ratings of random neighbors are accumulated,
+// the accumulated ratings are scanned, and the map is cleared afterwards.
+// Each iteration touches 2^18 random keys, such that the keys accessed in a
+// round are usually not cached. Arguments: size of the key universe, number of
+// neighbors per round.
+template <typename Map>
+static void BM_Accumulate(::benchmark::State& state) {
+  const HypernodeID universe = state.range(0);
+  const size_t num_neighbors = state.range(1);
+  const size_t num_rounds = (1 << 18) / num_neighbors;
+  const std::vector<HypernodeID> keys = randomKeys(num_rounds * num_neighbors, universe, 42);
+  Map map(universe);
+  for (auto _ : state) {
+    for (size_t round = 0; round < num_rounds; ++round) {
+      for (size_t i = round * num_neighbors; i < (round + 1) * num_neighbors; ++i) {
+        map[keys[i]] += 1.0;
+      }
+      RatingType max_rating = 0.0;
+      for (auto it = map.end() - 1; it >= map.begin(); --it) {
+        max_rating = std::max(max_rating, it->value);
+      }
+      ::benchmark::DoNotOptimize(max_rating);
+      map.clear();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_rounds * num_neighbors);
+}
+
+// Lookups of contained and missing keys in a map with the given number of elements.
+// FlatHashMap grows to a capacity of 4096 slots for all arguments, i.e., the arguments
+// correspond to load factors of 44%, 59%, 73% and 87%.
+template <typename Map>
+static void BM_Lookup(::benchmark::State& state) {
+  const size_t num_elements = state.range(0);
+  const HypernodeID universe = 1 << 24;
+  const std::vector<HypernodeID> elements = randomKeys(num_elements, universe, 42);
+  const std::vector<HypernodeID> queries = randomKeys(num_elements, universe, 23);
+  Map map(num_elements);
+  for (const HypernodeID key : elements) {
+    map[key] = 1.0;
+  }
+  for (auto _ : state) {
+    size_t found = 0;
+    for (size_t i = 0; i < num_elements; ++i) {
+      found += map.contains(elements[i]);
+      found += map.contains(queries[i]);
+    }
+    ::benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * num_elements);
+}
+
+static void universesAndNeighbors(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({ { 1 << 14, 1 << 20, 1 << 24 }, { 16, 256, 4096 } });
+}
+
+static void fillRates(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->Arg(1800)->Arg(2400)->Arg(3000)->Arg(3580);
+}
+
+BENCHMARK_TEMPLATE(BM_Accumulate, RatingSparseMap)->Apply(universesAndNeighbors);
+BENCHMARK_TEMPLATE(BM_Accumulate, RatingFlatHashMap)->Apply(universesAndNeighbors);
+
+BENCHMARK_TEMPLATE(BM_Lookup, RatingFlatHashMap)->Apply(fillRates);
+BENCHMARK_TEMPLATE(BM_Lookup, RatingHashMap)->Apply(fillRates);
+}  // namespace ds
+}  // namespace kahypar
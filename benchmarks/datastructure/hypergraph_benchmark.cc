@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "benchmarks/benchmark_instances.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace ds {
+static constexpr HypernodeID kMaxNetSize = 16;
+
+static void BM_Contract(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  size_t num_contractions = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<Hypergraph> hypergraph =
+      bench::randomHypergraph(num_hypernodes, num_hypernodes, kMaxNetSize);
+    state.ResumeTiming();
+    num_contractions += bench::randomContractions(*hypergraph, num_hypernodes / 2).size();
+  }
+  state.SetItemsProcessed(num_contractions);
+}
+
+static void BM_Uncontract(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  const PartitionID k = state.range(1);
+  size_t num_uncontractions = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<Hypergraph> hypergraph =
+      bench::randomHypergraph(num_hypernodes, num_hypernodes, kMaxNetSize, k);
+    const std::vector<Hypergraph::Memento> history =
+      bench::randomContractions(*hypergraph, num_hypernodes / 2);
+    bench::randomPartition(*hypergraph);
+    state.ResumeTiming();
+    for (auto rit = history.crbegin(); rit != history.crend(); ++rit) {
+      hypergraph->uncontract(*rit);
+    }
+    num_uncontractions += history.size();
+  }
+  state.SetItemsProcessed(num_uncontractions);
+}
+
+static void BM_ChangeNodePart(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  const PartitionID k = state.range(1);
+  std::unique_ptr<Hypergraph> hypergraph =
+    bench::randomHypergraph(num_hypernodes, num_hypernodes, kMaxNetSize, k);
+  bench::randomPartition(*hypergraph);
+  for (auto _ : state) {
+    for (const HypernodeID& hn : hypergraph->nodes()) {
+      const PartitionID from = hypergraph->partID(hn);
+      hypergraph->changeNodePart(hn, from, (from + 1) % k);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_hypernodes);
+}
+
+BENCHMARK(BM_Contract)->RangeMultiplier(8)->Range(1 << 10, 1 << 16)
+->Unit(::benchmark::kMillisecond);
+BENCHMARK(BM_Uncontract)->ArgsProduct({ { 1 << 10, 1 << 13, 1 << 16 }, { 2, 8, 64 } })
+->Unit(::benchmark::kMillisecond);
+BENCHMARK(BM_ChangeNodePart)->ArgsProduct({ { 1 << 10, 1 << 13, 1 << 16 }, { 2, 8, 64 } })
+->Unit(::benchmark::kMillisecond);
+}  // namespace ds
+}  // namespace kahypar
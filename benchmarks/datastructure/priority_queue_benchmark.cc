@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/bucket_queue.h"
+#include "kahypar/datastructure/kway_priority_queue.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace ds {
+static constexpr Gain kMaxKey = 1000;
+
+using MaxHeap = BinaryMaxHeap<HypernodeID, Gain>;
+using MinHeap = BinaryMinHeap<HypernodeID, Gain>;
+using MaxHeap4 = DaryMaxHeap<HypernodeID, Gain, 4>;
+using MaxHeap8 = DaryMaxHeap<HypernodeID, Gain, 8>;
+using BucketQueue = EnhancedBucketQueue<HypernodeID, Gain, std::numeric_limits<Gain> >;
+
+template <typename Queue>
+using KWayPQ = KWayPriorityQueue<HypernodeID, Gain, std::numeric_limits<Gain>, false, Queue>;
+
+static std::vector<Gain> randomKeys(const size_t num_keys) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<Gain> key_dist(-kMaxKey + 1, kMaxKey);
+  std::vector<Gain> keys(num_keys);
+  for (Gain& key : keys) {
+    key = key_dist(gen);
+  }
+  return keys;
+}
+
+// EnhancedBucketQueue does not support updates that leave the key unchanged,
+// therefore each updated key differs from the original one.
+static std::vector<Gain> updatedKeys(const std::vector<Gain>& keys) {
+  std::mt19937 gen(23);
+  std::uniform_int_distribution<Gain> shift_dist(1, 2 * kMaxKey - 1);
+  std::vector<Gain> updated_keys(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    updated_keys[i] = (keys[i] + kMaxKey - 1 + shift_dist(gen)) % (2 * kMaxKey) - kMaxKey + 1;
+  }
+  return updated_keys;
+}
+
+template <typename Queue>
+static void BM_PushPop(::benchmark::State& state) {
+  const HypernodeID num_elements = state.range(0);
+  const std::vector<Gain> keys = randomKeys(num_elements);
+  Queue queue(num_elements, kMaxKey);
+  for (auto _ : state) {
+    for (HypernodeID id = 0; id < num_elements; ++id) {
+      queue.push(id, keys[id]);
+    }
+    while (!queue.empty()) {
+      ::benchmark::DoNotOptimize(queue.top());
+      queue.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_elements * 2);
+}
+
+template <typename Queue>
+static void BM_UpdateKey(::benchmark::State& state) {
+  const HypernodeID num_elements = state.range(0);
+  const std::vector<Gain> keys = randomKeys(num_elements);
+  const std::vector<Gain> updated_keys = updatedKeys(keys);
+  Queue queue(num_elements, kMaxKey);
+  for (HypernodeID id = 0; id < num_elements; ++id) {
+    queue.push(id, keys[id]);
+  }
+  for (auto _ : state) {
+    for (HypernodeID id = 0; id < num_elements; ++id) {
+      queue.updateKey(id, updated_keys[id]);
+    }
+    state.PauseTiming();
+    for (HypernodeID id = 0; id < num_elements; ++id) {
+      queue.updateKey(id, keys[id]);
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * num_elements);
+}
+
+template <typename Queue>
+static void BM_KWayInsertDeleteMax(::benchmark::State& state) {
+  const HypernodeID num_elements = state.range(0);
+  const PartitionID k = state.range(1);
+  const std::vector<Gain> keys = randomKeys(num_elements);
+  KWayPQ<Queue> pq(k);
+  pq.initialize(num_elements, kMaxKey);
+  HypernodeID max_id = 0;
+  Gain max_key = 0;
+  PartitionID max_part = 0;
+  for (auto _ : state) {
+    for (HypernodeID id = 0; id < num_elements; ++id) {
+      pq.insert(id, id % k, keys[id]);
+    }
+    for (PartitionID part = 0; part < k; ++part) {
+      pq.enablePart(part);
+    }
+    while (!pq.empty()) {
+      pq.deleteMax(max_id, max_key, max_part);
+      ::benchmark::DoNotOptimize(max_id);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_elements * 2);
+}
+
+template <typename Queue>
+static void BM_KWayUpdateKey(::benchmark::State& state) {
+  const HypernodeID num_elements = state.range(0);
+  const PartitionID k = state.range(1);
+  const std::vector<Gain> keys = randomKeys(num_elements);
+  const std::vector<Gain> updated_keys = updatedKeys(keys);
+  KWayPQ<Queue> pq(k);
+  pq.initialize(num_elements, kMaxKey);
+  for (HypernodeID id = 0; id < num_elements; ++id) {
+    pq.insert(id, id % k, keys[id]);
+  }
+  for (auto _ : state) {
+    for (HypernodeID id = 0; id < num_elements; ++id) {
+      pq.updateKey(id, id % k, updated_keys[id]);
+    }
+    state.PauseTiming();
+    for (HypernodeID id = 0; id < num_elements; ++id) {
+      pq.updateKey(id, id % k, keys[id]);
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * num_elements);
+}
+
+static void sizes(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+}
+
+static void sizesAndBlocks(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({ { 1 << 10, 1 << 14, 1 << 18 }, { 2, 8, 64 } });
+}
+
+BENCHMARK_TEMPLATE(BM_PushPop, MaxHeap)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, MinHeap)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, MaxHeap4)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, MaxHeap8)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, BucketQueue)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_UpdateKey, MaxHeap)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_UpdateKey, MinHeap)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_UpdateKey, MaxHeap4)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_UpdateKey, MaxHeap8)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_UpdateKey, BucketQueue)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_KWayInsertDeleteMax, MaxHeap)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_KWayInsertDeleteMax, MaxHeap4)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_KWayInsertDeleteMax, MaxHeap8)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_KWayInsertDeleteMax, BucketQueue)->Apply(sizesAndBlocks);
+
+BENCHMARK_TEMPLATE(BM_KWayUpdateKey, MaxHeap)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_KWayUpdateKey, MaxHeap4)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_KWayUpdateKey, MaxHeap8)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_KWayUpdateKey, BucketQueue)->Apply(sizesAndBlocks);
+}  // namespace ds
+}  // namespace kahypar
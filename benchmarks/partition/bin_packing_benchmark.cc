@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmarks/benchmark_instances.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/bin_packing/bin_packing_algorithms.h"
+#include "kahypar/partition/bin_packing/bin_packing_utils.h"
+
+namespace kahypar {
+using bin_packing::BinTreeFirstFit;
+using bin_packing::FirstFit;
+using bin_packing::LinearFirstFit;
+using bin_packing::WorstFit;
+
+// Inserts 2^16 elements of random weight into num_bins bins. The first argument
+// is the number of bins. The maximum bin weight is chosen such that the bins
+// fill up over time, i.e., later insertions have to skip more bins.
+template <class BPAlgorithm>
+static void BM_InsertElements(::benchmark::State& state) {
+  const PartitionID num_bins = state.range(0);
+  const size_t num_elements = 1 << 16;
+  std::mt19937 gen(bench::kSeed);
+  std::uniform_int_distribution<HypernodeWeight> weight_dist(1, 100);
+  std::vector<HypernodeWeight> weights(num_elements);
+  HypernodeWeight total_weight = 0;
+  for (HypernodeWeight& weight : weights) {
+    weight = weight_dist(gen);
+    total_weight += weight;
+  }
+  const HypernodeWeight max_bin_weight = total_weight / num_bins;
+
+  for (auto _ : state) {
+    BPAlgorithm algorithm(num_bins, max_bin_weight);
+    for (const HypernodeWeight& weight : weights) {
+      ::benchmark::DoNotOptimize(algorithm.insertElement(weight));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_elements);
+}
+
+BENCHMARK_TEMPLATE(BM_InsertElements, LinearFirstFit)->RangeMultiplier(4)->Range(2, 2048);
+BENCHMARK_TEMPLATE(BM_InsertElements, BinTreeFirstFit)->RangeMultiplier(4)->Range(2, 2048);
+BENCHMARK_TEMPLATE(BM_InsertElements, FirstFit)->RangeMultiplier(4)->Range(2, 2048);
+BENCHMARK_TEMPLATE(BM_InsertElements, WorstFit)->RangeMultiplier(4)->Range(2, 2048);
+
+// Hypergraph in which one out of 1000 hypernodes is heavy, as typical for
+// heuristic prepacking. The first argument is the number of hypernodes.
+static std::unique_ptr<Hypergraph> fewHeavyNodes(const HypernodeID num_hypernodes) {
+  std::unique_ptr<Hypergraph> hypergraph = bench::randomHypergraph(num_hypernodes, num_hypernodes, 8);
+  std::mt19937 gen(bench::kSeed);
+  std::uniform_int_distribution<HypernodeWeight> light_dist(1, 10);
+  std::uniform_int_distribution<HypernodeWeight> heavy_dist(1000, 2000);
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    hypergraph->setNodeWeight(hn, hn % 1000 == 0 ? heavy_dist(gen) : light_dist(gen));
+  }
+  return hypergraph;
+}
+
+static void BM_SortAllNodes(::benchmark::State& state) {
+  std::unique_ptr<Hypergraph> hypergraph = fewHeavyNodes(state.range(0));
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(bin_packing::nodesInDescendingWeightOrder(*hypergraph).data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SortHeavyNodes(::benchmark::State& state) {
+  std::unique_ptr<Hypergraph> hypergraph = fewHeavyNodes(state.range(0));
+  HypernodeWeight light_weight = 0;
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(
+      bin_packing::heavyNodesInDescendingWeightOrder(*hypergraph, 100, light_weight).data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SortAllNodes)->RangeMultiplier(8)->Range(1 << 12, 1 << 18);
+BENCHMARK(BM_SortHeavyNodes)->RangeMultiplier(8)->Range(1 << 12, 1 << 18);
+}  // namespace kahypar
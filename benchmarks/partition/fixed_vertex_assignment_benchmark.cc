@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "benchmarks/benchmark_instances.h"
+#include "kahypar/kahypar.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/fixed_vertices.h"
+
+namespace kahypar {
+static constexpr HypernodeID kNodesPerBlock = 16;
+
+// Random hypergraph with 16 * k hypernodes, 10% of which are fixed to random
+// blocks. All other hypernodes are assigned to random blocks, i.e., the
+// hypergraph is in the state in which the fixed vertices are assigned.
+static std::unique_ptr<Hypergraph> hypergraphWithFixedVertices(const PartitionID k) {
+  const HypernodeID num_hypernodes = kNodesPerBlock * k;
+  std::unique_ptr<Hypergraph> hypergraph =
+    bench::randomHypergraph(num_hypernodes, num_hypernodes, 8, k);
+  std::mt19937 gen(bench::kSeed);
+  std::uniform_int_distribution<PartitionID> part_dist(0, k - 1);
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    if (hn % 10 == 0) {
+      hypergraph->setFixedVertex(hn, part_dist(gen));
+    } else {
+      hypergraph->setNodePart(hn, part_dist(gen));
+    }
+  }
+  return hypergraph;
+}
+
+static Context fixedVertexContext(const PartitionID k) {
+  Context context;
+  context.partition.k = k;
+  context.partition.objective = Objective::km1;
+  context.partition.max_part_weights.assign(k, std::numeric_limits<HypernodeWeight>::max() / 2);
+  return context;
+}
+
+// Setup of the bipartite graph and maximum weighted matching in the
+// bipartite graph that only contains the non-zero block pairs.
+static void BM_SparseFixedVertexAssignment(::benchmark::State& state) {
+  const PartitionID k = state.range(0);
+  std::unique_ptr<Hypergraph> hypergraph = hypergraphWithFixedVertices(k);
+  const Context context = fixedVertexContext(k);
+  for (auto _ : state) {
+    const fixed_vertices::SparseBipartiteGraph graph =
+      fixed_vertices::setupSparseWeightedBipartiteMatchingGraph(*hypergraph, context);
+    ::benchmark::DoNotOptimize(fixed_vertices::findMaximumWeightedBipartiteMatching(graph));
+  }
+}
+
+// Same as above using the dense k x k adjacency matrix. Infeasible
+// for k = 4096, since the residual graph alone has (2k + 2)^2 entries.
+static void BM_DenseFixedVertexAssignment(::benchmark::State& state) {
+  const PartitionID k = state.range(0);
+  std::unique_ptr<Hypergraph> hypergraph = hypergraphWithFixedVertices(k);
+  const Context context = fixedVertexContext(k);
+  for (auto _ : state) {
+    const fixed_vertices::AdjacencyMatrix graph =
+      fixed_vertices::setupWeightedBipartiteMatchingGraph(*hypergraph, context);
+    ::benchmark::DoNotOptimize(fixed_vertices::findMaximumWeightedBipartiteMatching(graph));
+  }
+}
+
+BENCHMARK(BM_SparseFixedVertexAssignment)->Arg(256)->Arg(4096)->Unit(::benchmark::kMillisecond);
+BENCHMARK(BM_DenseFixedVertexAssignment)->Arg(256)->Unit(::benchmark::kMillisecond);
+}  // namespace kahypar
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "benchmarks/benchmark_instances.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/2way_fm_refiner.h"
+#include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
+#include "kahypar/partition/refinement/kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+
+namespace kahypar {
+// Stops like NumberOfFruitlessMovesStopsSearch, but counts the moves
+// performed by the refiner (updateStatistics is called once per move).
+class CountingStopsSearch : public NumberOfFruitlessMovesStopsSearch {
+ public:
+  template <typename Gain>
+  void updateStatistics(const Gain) {
+    ++num_moves;
+  }
+
+  static inline size_t num_moves = 0;
+};
+
+using TwoWayRefiner = TwoWayFMRefiner<CountingStopsSearch>;
+using KWayCutRefiner = KWayFMRefiner<CountingStopsSearch>;
+using KWayKm1Refiner = KWayKMinusOneRefiner<CountingStopsSearch>;
+using KWaySoedRefiner = KWaySOEDRefiner<CountingStopsSearch>;
+
+static Context fmContext(const Hypergraph& hypergraph, const Objective objective) {
+  Context context;
+  context.partition.k = hypergraph.k();
+  context.partition.rb_lower_k = 0;
+  context.partition.rb_upper_k = context.partition.k - 1;
+  context.partition.epsilon = 0.03;
+  context.partition.mode = Mode::direct_kway;
+  context.partition.objective = objective;
+  context.local_search.fm.max_number_of_fruitless_moves = 350;
+  for (PartitionID part = 0; part < context.partition.k; ++part) {
+    context.partition.perfect_balance_part_weights.push_back(
+      std::ceil(hypergraph.totalWeight() / static_cast<double>(context.partition.k)));
+    context.partition.max_part_weights.push_back(
+      (1 + context.partition.epsilon) * context.partition.perfect_balance_part_weights[0]);
+  }
+  return context;
+}
+
+// Runs one FM pass seeded with all hypernodes of a randomly partitioned
+// hypergraph and reports the number of performed moves per second. The
+// first argument is the number of hypernodes, the second one the number of blocks.
+// Only the refiners themselves are measured, i.e., this is a throughput baseline
+// for changes to the FM refiners and not for the uncoarsening loop around them.
+template <class Refiner, Objective objective>
+static void BM_FMMoves(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  const PartitionID k = state.range(1);
+  std::unique_ptr<Hypergraph> hypergraph =
+    bench::randomHypergraph(num_hypernodes, num_hypernodes, 8, k);
+  const Context context = fmContext(*hypergraph, objective);
+  const std::array<HypernodeWeight, 2> max_allowed_part_weights = {
+    context.partition.max_part_weights[0], context.partition.max_part_weights[1] };
+  UncontractionGainChanges changes;
+  changes.representative.push_back(0);
+  changes.contraction_partner.push_back(0);
+
+  CountingStopsSearch::num_moves = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    hypergraph->resetPartitioning();
+    bench::randomPartition(*hypergraph);
+    Metrics metrics = { metrics::hyperedgeCut(*hypergraph),
+                        metrics::km1(*hypergraph),
+                        metrics::imbalance(*hypergraph, context) };
+    std::vector<HypernodeID> refinement_nodes(hypergraph->initialNumNodes());
+    for (HypernodeID hn = 0; hn < hypergraph->initialNumNodes(); ++hn) {
+      refinement_nodes[hn] = hn;
+    }
+    Refiner refiner(*hypergraph, context);
+    refiner.initialize(0);
+    state.ResumeTiming();
+    refiner.refine(refinement_nodes, max_allowed_part_weights, changes, metrics);
+  }
+  state.SetItemsProcessed(CountingStopsSearch::num_moves);
+}
+
+static void sizesAndBlocks(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({ { 1 << 12, 1 << 15 }, { 2, 8, 32 } })->Unit(::benchmark::kMillisecond);
+}
+
+BENCHMARK_TEMPLATE(BM_FMMoves, TwoWayRefiner, Objective::cut)
+->ArgsProduct({ { 1 << 12, 1 << 15 }, { 2 } })->Unit(::benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FMMoves, KWayCutRefiner, Objective::cut)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_FMMoves, KWayKm1Refiner, Objective::km1)->Apply(sizesAndBlocks);
+BENCHMARK_TEMPLATE(BM_FMMoves, KWaySoedRefiner, Objective::soed)->Apply(sizesAndBlocks);
+}  // namespace kahypar
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "benchmarks/benchmark_instances.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/refinement/kway_fm_gain_cache.h"
+
+namespace kahypar {
+static constexpr PartitionID kMaxAdjacentParts = 8;
+
+static void initializeGainCache(KwayGainCache<Gain>& cache, const HypernodeID num_hypernodes,
+                                const PartitionID k) {
+  for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+    for (PartitionID part = 0; part < std::min(k, kMaxAdjacentParts); ++part) {
+      cache.initializeEntry(hn, (hn + part) % k, static_cast<Gain>(hn % 7) - 3);
+    }
+  }
+}
+
+static void BM_GainCacheInitialize(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  const PartitionID k = state.range(1);
+  KwayGainCache<Gain> cache(num_hypernodes, k);
+  for (auto _ : state) {
+    initializeGainCache(cache, num_hypernodes, k);
+    state.PauseTiming();
+    cache.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * num_hypernodes * std::min(k, kMaxAdjacentParts));
+}
+
+// Simulates the gain cache updates caused by a sequence of moves
+// (delta update, connectivity decrease, connectivity increase) followed by
+// the rollback at the end of an unsuccessful local search.
+static void BM_GainCacheUpdateAndRollback(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  const PartitionID k = state.range(1);
+  KwayGainCache<Gain> cache(num_hypernodes, k);
+  initializeGainCache(cache, num_hypernodes, k);
+  for (auto _ : state) {
+    for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+      const PartitionID part = hn % k;
+      cache.updateExistingEntry(hn, part, 1);
+      cache.removeEntryDueToConnectivityDecrease(hn, part);
+      cache.addEntryDueToConnectivityIncrease(hn, part, 2);
+    }
+    cache.rollbackDelta();
+  }
+  state.SetItemsProcessed(state.iterations() * num_hypernodes * 3);
+}
+
+static void BM_GainCacheEntryAccess(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  const PartitionID k = state.range(1);
+  KwayGainCache<Gain> cache(num_hypernodes, k);
+  initializeGainCache(cache, num_hypernodes, k);
+  for (auto _ : state) {
+    Gain sum = 0;
+    for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+      for (const PartitionID& part : cache.adjacentParts(hn)) {
+        sum += cache.entry(hn, part);
+      }
+    }
+    ::benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * num_hypernodes * std::min(k, kMaxAdjacentParts));
+}
+
+static void sizesAndBlocks(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({ { 1 << 12, 1 << 15, 1 << 18 }, { 2, 8, 64, 256 } });
+}
+
+BENCHMARK(BM_GainCacheInitialize)->Apply(sizesAndBlocks);
+BENCHMARK(BM_GainCacheUpdateAndRollback)->Apply(sizesAndBlocks);
+BENCHMARK(BM_GainCacheEntryAccess)->Apply(sizesAndBlocks);
+}  // namespace kahypar
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmarks/benchmark_instances.h"
+#include "kahypar/application/command_line_options.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partitioner_facade.h"
+
+namespace kahypar {
+// Netlist-like hypergraph on a side x side grid: each hypernode is the source of a
+// net that contains its right and lower neighbors. The hypernode IDs are randomly
+// permuted, such that neighboring hypernodes are scattered over memory.
+static void scatteredGridHypergraph(const HypernodeID side,
+                                    HyperedgeIndexVector& index_vector,
+                                    HyperedgeVector& edge_vector) {
+  const HypernodeID num_hypernodes = side * side;
+  std::vector<HypernodeID> permutation(num_hypernodes);
+  std::iota(permutation.begin(), permutation.end(), 0);
+  std::shuffle(permutation.begin(), permutation.end(), std::mt19937(bench::kSeed));
+
+  index_vector.assign(1, 0);
+  edge_vector.clear();
+  for (HypernodeID row = 0; row < side; ++row) {
+    for (HypernodeID col = 0; col < side; ++col) {
+      if (row + 1 == side && col + 1 == side) {
+        continue;
+      }
+      edge_vector.push_back(permutation[row * side + col]);
+      if (col + 1 < side) {
+        edge_vector.push_back(permutation[row * side + col + 1]);
+      }
+      if (row + 1 < side) {
+        edge_vector.push_back(permutation[(row + 1) * side + col]);
+      }
+      index_vector.push_back(edge_vector.size());
+    }
+  }
+}
+
+// Partitions a scattered grid hypergraph into 8 blocks using the km1 configuration
+// of direct k-way KaHyPar. The first argument is the node ordering, the second
+// one the side length of the grid. The config path is relative to the build
+// directory of the benchmark (build/benchmarks/partition).
+static void BM_PartitionWithNodeOrdering(::benchmark::State& state) {
+  const NodeOrdering ordering = static_cast<NodeOrdering>(state.range(0));
+  const HypernodeID side = state.range(1);
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  scatteredGridHypergraph(side, index_vector, edge_vector);
+
+  HyperedgeWeight km1 = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Context context;
+    parseIniToContext(context, "../../../config/km1_kKaHyPar_sea20.ini");
+    context.partition.k = 8;
+    context.partition.epsilon = 0.03;
+    context.partition.seed = bench::kSeed;
+    context.partition.quiet_mode = true;
+    context.preprocessing.node_ordering = ordering;
+    Hypergraph hypergraph(side * side, index_vector.size() - 1,
+                          index_vector, edge_vector, context.partition.k);
+    state.ResumeTiming();
+
+    PartitionerFacade().partition(hypergraph, context);
+
+    km1 = metrics::km1(hypergraph);
+  }
+  state.SetLabel("km1=" + std::to_string(km1));
+}
+
+BENCHMARK(BM_PartitionWithNodeOrdering)
+->ArgsProduct({ { static_cast<int64_t>(NodeOrdering::input),
+                  static_cast<int64_t>(NodeOrdering::bfs),
+                  static_cast<int64_t>(NodeOrdering::degree) }, { 256, 512 } })
+->Unit(::benchmark::kMillisecond)
+->Iterations(3);
+}  // namespace kahypar
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <memory>
+
+#include "benchmarks/benchmark_instances.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/vertex_pair_rater.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+using Rater = VertexPairRater<>;
+
+// Rates every hypernode of a random hypergraph once. The first argument is the
+// number of hypernodes, the second one the maximum net size.
+static void BM_Rate(::benchmark::State& state) {
+  const HypernodeID num_hypernodes = state.range(0);
+  const HypernodeID max_net_size = state.range(1);
+  std::unique_ptr<Hypergraph> hypergraph =
+    bench::randomHypergraph(num_hypernodes, num_hypernodes, max_net_size);
+  Context context;
+  context.coarsening.max_allowed_node_weight = std::numeric_limits<HypernodeWeight>::max();
+  Rater rater(*hypergraph, context);
+  for (auto _ : state) {
+    for (const HypernodeID& hn : hypergraph->nodes()) {
+      ::benchmark::DoNotOptimize(rater.rate(hn).target);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_hypernodes);
+}
+
+BENCHMARK(BM_Rate)->ArgsProduct({ { 1 << 12, 1 << 14, 1 << 16 }, { 4, 16, 32 } })
+->Unit(::benchmark::kMillisecond);
+}  // namespace kahypar
@@ -0,0 +1,14 @@
+# micro benchmarks are built against google benchmark but are neither
+# registered as tests nor executed after the build.
+function(add_kahypar_benchmark target)
+    add_executable(${target} ${ARGN})
+    target_link_libraries(${target} benchmark::benchmark benchmark::benchmark_main ${CMAKE_THREAD_LIBS_INIT})
+
+    set_property(TARGET ${target} PROPERTY CXX_STANDARD 17)
+    set_property(TARGET ${target} PROPERTY CXX_STANDARD_REQUIRED ON)
+
+    if(NOT TARGET benchmarks)
+      add_custom_target(benchmarks)
+    endif()
+    add_dependencies(benchmarks ${target})
+endfunction()
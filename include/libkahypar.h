@@ -55,6 +55,31 @@ typedef int kahypar_hypernode_weight_t;
 typedef int kahypar_hyperedge_weight_t;
 typedef int kahypar_partition_id_t;
 
+/* Called with the partition, the objective and the imbalance of each improving
+ * solution found during partitioning (anytime partitioning). The partition array
+ * is only valid during the call and has to be copied if it is needed afterwards. */
+typedef void (* kahypar_improved_solution_callback_t)(const kahypar_partition_id_t* partition,
+                                                      const kahypar_hyperedge_weight_t objective,
+                                                      const double imbalance,
+                                                      void* user_data);
+
+typedef enum {
+  KAHYPAR_PROGRESS_COARSENING = 0,
+  KAHYPAR_PROGRESS_INITIAL_PARTITIONING = 1,
+  KAHYPAR_PROGRESS_UNCOARSENING = 2
+} kahypar_progress_phase_t;
+
+/* Called periodically during partitioning with the current phase, the number of
+ * contractions that are currently not undone (i.e., the current level of the
+ * n-level hierarchy), the current number of vertices and the objective of the
+ * current partition (0 during coarsening). Returning a nonzero value cancels
+ * the partitioning call (see kahypar_cancel_partitioning). */
+typedef int (* kahypar_progress_callback_t)(const kahypar_progress_phase_t phase,
+                                            const size_t level,
+                                            const kahypar_hypernode_id_t num_vertices,
+                                            const kahypar_hyperedge_weight_t objective,
+                                            void* user_data);
+
 KAHYPAR_API kahypar_context_t* kahypar_context_new();
 KAHYPAR_API void kahypar_context_free(kahypar_context_t* kahypar_context);
 KAHYPAR_API void kahypar_configure_context_from_file(kahypar_context_t* kahypar_context,
@@ -66,6 +91,26 @@ KAHYPAR_API void kahypar_set_custom_target_block_weights(const kahypar_partition
                                                          const kahypar_hypernode_weight_t* block_weights,
                                                          kahypar_context_t* kahypar_context);
 
+/* Registers a callback that is invoked for each improving solution found during
+ * subsequent partitioning calls using this context. Passing NULL removes the callback. */
+KAHYPAR_API void kahypar_set_improved_solution_callback(kahypar_context_t* kahypar_context,
+                                                        kahypar_improved_solution_callback_t callback,
+                                                        void* user_data);
+
+/* Registers a callback that reports the progress of subsequent partitioning calls
+ * using this context. Passing NULL removes the callback. */
+KAHYPAR_API void kahypar_set_progress_callback(kahypar_context_t* kahypar_context,
+                                               kahypar_progress_callback_t callback,
+                                               void* user_data);
+
+/* Requests cancellation of the partitioning call that currently uses this context.
+ * If no partitioning call uses the context, the next call using it is cancelled.
+ * Calls using other contexts are not affected. This function can be called from any thread.
+ * Cancellation is cooperative: the partitioning call returns as soon as possible
+ * with a complete, but possibly low-quality partition. Afterwards, the context
+ * can be reused. */
+KAHYPAR_API void kahypar_cancel_partitioning(kahypar_context_t* kahypar_context);
+
 KAHYPAR_API void kahypar_set_fixed_vertices(kahypar_hypergraph_t* hypergraph,
                                             const kahypar_partition_id_t* fixed_vertex_blocks);
 
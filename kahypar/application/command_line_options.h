@@ -94,11 +94,14 @@ po::options_description createGeneralOptionsDescription(Context& context, const
         context.partition.objective = Objective::cut;
       } else if (s == "km1") {
         context.partition.objective = Objective::km1;
+      } else if (s == "soed") {
+        context.partition.objective = Objective::soed;
       }
     }),
     "Objective: \n"
-    " - cut : cut-net metric \n"
-    " - km1 : (lambda-1) metric")
+    " - cut  : cut-net metric \n"
+    " - km1  : (lambda-1) metric \n"
+    " - soed : sum of external degrees (lambda for each cut net)")
     ("mode,m",
     po::value<std::string>()->value_name("<string>")->required()->notifier(
       [&](const std::string& mode) {
@@ -208,6 +211,7 @@ po::options_description createCoarseningOptionsDescription(Context& context,
     }),
     "Coarsening Algorithm:\n"
     " - ml_style\n"
+    " - ml_hierarchy (level-wise hierarchy)\n"
     " - heavy_full\n"
     " - heavy_lazy")
     ((initial_partitioning ? "i-c-s" : "c-s"),
@@ -314,6 +318,7 @@ po::options_description createRefinementOptionsDescription(Context& context,
     " - kway_fm_hyperflow_cutter     : k-way FM + HyperFlowCutter (direct k-way        : cut)\n"
     " - kway_fm_km1                  : k-way FM algorithm         (direct k-way        : km1)\n"
     " - kway_fm_hyperflow_cutter_km1 : k-way FM + HyperFlowCutter (direct k-way        : km1)\n"
+    " - kway_fm_soed                 : k-way FM algorithm         (direct k-way        : soed)\n"
     " - kway_hyperflow_cutter        : k-way HyperFlowCutter      (direct k-way        : cut & km1)\n"
     )
     ((initial_partitioning ? "i-r-runs" : "r-runs"),
@@ -331,6 +336,14 @@ po::options_description createRefinementOptionsDescription(Context& context,
     }),
     "Max. # local search repetitions on each level\n"
     "(no limit:-1)")
+    ((initial_partitioning ? "i-r-uncontraction-batch-size" : "r-uncontraction-batch-size"),
+    po::value<HypernodeID>((initial_partitioning ? &context.initial_partitioning.local_search.uncontraction_batch_size : &context.local_search.uncontraction_batch_size))->value_name("<int>"),
+    "# uncontractions performed before one local search is started on all uncontracted hypernodes\n"
+    "(default: 1)")
+    ((initial_partitioning ? "i-r-fast-projection" : "r-fast-projection"),
+    po::value<bool>((initial_partitioning ? &context.initial_partitioning.local_search.fast_projection : &context.local_search.fast_projection))->value_name("<bool>"),
+    "Project the coarsest partition to the input hypergraph without intermediate refinement\n"
+    "and only refine the input hypergraph (default: false)")
     ((initial_partitioning ? "i-r-fm-stop" : "r-fm-stop"),
     po::value<std::string>()->value_name("<string>")->notifier(
       [&context, initial_partitioning](const std::string& stopfm) {
@@ -421,6 +434,15 @@ po::options_description createPreprocessingOptionsDescription(Context& context,
     ("p-enable-deduplication",
     po::value<bool>(&context.preprocessing.enable_deduplication)->value_name("<bool>"),
     "Remove identical vertices and parallel nets before partitioning")
+    ("p-node-ordering",
+    po::value<std::string>()->value_name("<string>")->notifier(
+      [&](const std::string& ordering) {
+      context.preprocessing.node_ordering = kahypar::nodeOrderingFromString(ordering);
+    }),
+    "Renumber hypernodes and hyperedges for cache locality before partitioning:\n"
+    " - input  : keep the IDs of the input (default)\n"
+    " - bfs    : breadth-first search order\n"
+    " - degree : hypernodes sorted by decreasing degree")
     ("p-use-sparsifier",
     po::value<bool>(&context.preprocessing.enable_min_hash_sparsifier)->value_name("<bool>"),
     "Use min-hash pin sparsifier before partitioning")
@@ -575,7 +597,20 @@ po::options_description createEvolutionaryOptionsDescription(Context& context,
       context.evolutionary.edge_frequency_chance = edge_chance;
     }),
     "The Chance of a mutation being selected as operation\n"
-    "default: 0.5)");
+    "default: 0.5)")
+    ("checkpoint",
+    po::value<std::string>(&context.evolutionary.checkpoint_filename)->value_name("<string>"),
+    "File to which the population is periodically written during evolutionary partitioning.\n"
+    "default: None (no checkpoints are written)")
+    ("checkpoint-interval",
+    po::value<double>(&context.evolutionary.checkpoint_interval)->value_name("<double>"),
+    "Seconds between two checkpoints.\n"
+    "default: 60)")
+    ("resume",
+    po::value<bool>(&context.evolutionary.resume)->value_name("<bool>"),
+    "Continue evolutionary partitioning from the checkpoint given via --checkpoint.\n"
+    "Only the remaining part of --time-limit is used.\n"
+    "default: false)");
   return evolutionary_options;
 }
 
@@ -592,18 +627,32 @@ po::options_description createGenericOptionsDescription(Context& context,
     "Quiet Mode: Completely suppress console output")
     ("time-limit", po::value<int>(&context.partition.time_limit)->value_name("<int>"),
     "Sets a time limit in seconds. default: disabled. "
-    "We stop refinement once a large part (default 99%) is exceeded."
-    "It is never triggered before an initial partition is available, so you should still provide an external timeout (only now you might get a solution).")
+    "Once a large part (default 99%) is exceeded, all phases degrade gracefully: "
+    "preprocessing and coarsening stop early, initial partitioning performs a single run, "
+    "flow-based refinement is skipped and uncoarsening only projects the partition. "
+    "Since an initial partition is still computed, the limit can be exceeded slightly.")
     ("time-limit-factor", po::value<double>(&context.partition.soft_time_limit_factor)->value_name("<double>"),
-    "Controls the refinement time limit. default: 0.99")
+    "Controls the fraction of the time limit after which phases are cut short. default: 0.99")
     ("time-limit-check-frequency", po::value<int>(&context.partition.soft_time_limit_check_frequency)->value_name("<int>"),
-    "After how many uncontractions the soft time limit shall be checked. default 10000")
+    "After how many (un)contractions the time limit shall be checked. default 10000")
     ("time-limited-repeated-partitioning", po::value<bool>(&context.partition.time_limited_repeated_partitioning)->value_name("<bool>"),
     "Use repeated partitioning with the strict time limit set using --time-limit. This also uses the soft time limit.")
     ("sp-process,s", po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>"),
     "Summarize partitioning results in RESULT line compatible with sqlplottools "
     "(https://github.com/bingmann/sqlplottools)")
-    ("write-partition,w", po::value<bool>(&context.partition.write_partition_file)->value_name("<bool>"), "Write output partition. Default: false");
+    ("write-partition,w", po::value<bool>(&context.partition.write_partition_file)->value_name("<bool>"), "Write output partition. Default: false")
+    ("anytime", po::value<bool>(&context.partition.anytime_partition_output)->value_name("<bool>"),
+    "Atomically write each improving partition found during partitioning to the output partition "
+    "file, such that the file always contains the best partition found so far. "
+    "Requires --write-partition=true. Default: false")
+    ("trace-file", po::value<std::string>(&context.partition.trace_filename)->value_name("<string>"),
+    "Record a hierarchical trace of all phases, (un)coarsening levels, initial partitioning runs and "
+    "flow refinement calls and write it to the given file in Chrome trace format "
+    "(chrome://tracing, https://ui.perfetto.dev). default: disabled")
+    ("perf-counters", po::value<bool>(&context.partition.perf_counters)->value_name("<bool>"),
+    "Measure cycles, instructions, LLC misses and branch misses of the main phases and hot kernels "
+    "using hardware performance counters. Requires building with -DKAHYPAR_ENABLE_PERF_COUNTERS=ON. "
+    "default: false");
   return generic_options;
 }
 
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -34,6 +35,10 @@ namespace ds {
 template <typename Derived>
 struct BinaryHeapTraits;
 
+// Addressable d-ary heap. The arity is determined by the traits of the derived class.
+// Position 0 holds a sentinel and the children of position i are located at positions
+// arity * (i - 1) + 2, ..., arity * i + 1. The heap array is aligned such that the
+// children of each element share as few cache lines as possible.
 template <class Derived>
 class BinaryHeapBase {
  private:
@@ -43,6 +48,9 @@ class BinaryHeapBase {
   using IDType = typename BinaryHeapTraits<Derived>::IDType;
   using Comparator = typename BinaryHeapTraits<Derived>::Comparator;
 
+  static constexpr size_t arity = BinaryHeapTraits<Derived>::arity;
+  static_assert(arity >= 2, "Heap arity has to be at least two");
+
  protected:
   struct HeapElement {
     explicit HeapElement(const KeyType& key_ = BinaryHeapTraits<Derived>::sentinel(),
@@ -54,8 +62,19 @@ class BinaryHeapBase {
     KeyType key;
   };
 
+  static constexpr size_t kCacheLineSize = 64;
+  static constexpr size_t kChildrenSize = arity * sizeof(HeapElement);
+  // Alignment of the first child of each element. Only used if the children
+  // of an element can be packed into the cache lines without overlap.
+  static constexpr size_t kChildrenAlignment =
+    ((kChildrenSize & (kChildrenSize - 1)) == 0 &&
+     (sizeof(HeapElement) & (sizeof(HeapElement) - 1)) == 0) ?
+    std::min(kChildrenSize, kCacheLineSize) : sizeof(HeapElement);
+  static constexpr size_t kPadding = kChildrenAlignment / sizeof(HeapElement);
+
   explicit BinaryHeapBase(const IDType& size) :
-    _heap(std::make_unique<HeapElement[]>(static_cast<size_t>(size) + 1)),
+    _heap_storage(std::make_unique<HeapElement[]>(static_cast<size_t>(size) + 1 + kPadding)),
+    _heap(alignedHeap(_heap_storage.get())),
     _handles(std::make_unique<size_t[]>(size)),
     _compare(),
     _next_slot(0),
@@ -263,13 +282,13 @@ class BinaryHeapBase {
 
     const KeyType rising_key = _heap[heap_position].key;
     const IDType rising_id = _heap[heap_position].id;
-    size_t next_position = heap_position >> 1;
+    size_t next_position = parent(heap_position);
     while (_compare(_heap[next_position].key, rising_key)) {
       ASSERT(next_position != 0, "Swapping sentinel.");
       _heap[heap_position] = _heap[next_position];
       _handles[_heap[heap_position].id] = heap_position;
       heap_position = next_position;
-      next_position >>= 1;
+      next_position = parent(next_position);
     }
 
     _heap[heap_position].key = rising_key;
@@ -281,6 +300,10 @@ class BinaryHeapBase {
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void downHeap(size_t heap_position) {
     ASSERT(0 != heap_position, "calling downHeap for the sentinel");
     ASSERT(_next_slot > heap_position, "position specified larger than heap size");
+    if constexpr (arity != 2) {
+      downDaryHeap(heap_position);
+      return;
+    }
     const KeyType dropping_key = _heap[heap_position].key;
     const IDType dropping_id = _heap[heap_position].id;
     const size_t heap_size = _next_slot;
@@ -309,9 +332,84 @@ class BinaryHeapBase {
     HEAVY_DATA_STRUCTURE_ASSERT(isHeap(), "Heap invariant violated!");
   }
 
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void downDaryHeap(size_t heap_position) {
+    const KeyType dropping_key = _heap[heap_position].key;
+    const IDType dropping_id = _heap[heap_position].id;
+    const size_t heap_size = _next_slot;
+    size_t first_child = firstChild(heap_position);
+    while (first_child < heap_size) {
+      const size_t max_child = first_child + arity <= heap_size ?
+                               maxOfAllChildren(first_child) :
+                               maxOfChildren(first_child, heap_size);
+      const KeyType max_key = _heap[max_child].key;
+      if (!_compare(dropping_key, max_key)) {
+        break;
+      }
+      _heap[heap_position] = _heap[max_child];
+      _handles[_heap[heap_position].id] = heap_position;
+      heap_position = max_child;
+      first_child = firstChild(heap_position);
+    }
+
+    _heap[heap_position].key = dropping_key;
+    _heap[heap_position].id = dropping_id;
+    _handles[dropping_id] = heap_position;
+    HEAVY_DATA_STRUCTURE_ASSERT(isHeap(), "Heap invariant violated!");
+  }
+
+  // Selects the child with the highest priority in a tournament. The winner of each
+  // comparison is computed arithmetically (like in the binary downHeap) to avoid
+  // branch mispredictions.
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t maxOfAllChildren(const size_t first_child) const {
+    size_t winners[arity];
+    for (size_t i = 0; i < arity; ++i) {
+      winners[i] = first_child + i;
+    }
+    for (size_t width = arity; width > 1; width = (width + 1) / 2) {
+      for (size_t i = 0; i < width / 2; ++i) {
+        winners[i] = winner(winners[2 * i], winners[2 * i + 1]);
+      }
+      if (width % 2 == 1) {
+        winners[width / 2] = winners[width - 1];
+      }
+    }
+    return winners[0];
+  }
+
+  // Used for the last element with children, which might not have arity children.
+  size_t maxOfChildren(const size_t first_child, const size_t heap_size) const {
+    size_t max_child = first_child;
+    for (size_t child = first_child + 1; child < heap_size; ++child) {
+      max_child = winner(max_child, child);
+    }
+    return max_child;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t winner(const size_t a, const size_t b) const {
+    return a + (b - a) * _compare(_heap[a].key, _heap[b].key);
+  }
+
+  static constexpr size_t parent(const size_t heap_position) {
+    return (heap_position + arity - 2) / arity;
+  }
+
+  static constexpr size_t firstChild(const size_t heap_position) {
+    return arity * (heap_position - 1) + 2;
+  }
+
+  // Shifts the heap array such that the first child of the root is aligned.
+  static HeapElement* alignedHeap(HeapElement* storage) {
+    for (size_t offset = 0; offset < kPadding; ++offset) {
+      if (reinterpret_cast<std::uintptr_t>(storage + offset + 2) % kChildrenAlignment == 0) {
+        return storage + offset;
+      }
+    }
+    return storage;
+  }
+
   bool isHeap() const {
     for (size_t i = 1; i < _next_slot; ++i) {
-      if (_compare(_heap[i / 2].key, _heap[i].key)) {
+      if (_compare(_heap[parent(i)].key, _heap[i].key)) {
         return false;
       }
     }
@@ -320,6 +418,7 @@ class BinaryHeapBase {
 
   friend void swap(BinaryHeapBase& a, BinaryHeapBase& b) {
     using std::swap;
+    swap(a._heap_storage, b._heap_storage);
     swap(a._heap, b._heap);
     swap(a._handles, b._handles);
     swap(a._compare, b._compare);
@@ -327,7 +426,8 @@ class BinaryHeapBase {
     swap(a._max_size, b._max_size);
   }
 
-  std::unique_ptr<HeapElement[]> _heap;
+  std::unique_ptr<HeapElement[]> _heap_storage;
+  HeapElement* _heap;
   std::unique_ptr<size_t[]> _handles;
 
   Comparator _compare;
@@ -335,21 +435,22 @@ class BinaryHeapBase {
   size_t _max_size;
 };
 
-template <typename IDType_, typename KeyType_>
-class BinaryMaxHeap final : public BinaryHeapBase<BinaryMaxHeap<IDType_, KeyType_> >{
-  using Base = BinaryHeapBase<BinaryMaxHeap<IDType_, KeyType_> >;
+template <typename IDType_, typename KeyType_, size_t arity_ = 2>
+class DaryMaxHeap final : public BinaryHeapBase<DaryMaxHeap<IDType_, KeyType_, arity_> >{
+  using Base = BinaryHeapBase<DaryMaxHeap<IDType_, KeyType_, arity_> >;
   friend Base;
 
  public:
-  using IDType = typename BinaryHeapTraits<BinaryMaxHeap>::IDType;
-  using KeyType = typename BinaryHeapTraits<BinaryMaxHeap>::KeyType;
+  using IDType = typename BinaryHeapTraits<DaryMaxHeap>::IDType;
+  using KeyType = typename BinaryHeapTraits<DaryMaxHeap>::KeyType;
+  using Comparator = typename BinaryHeapTraits<DaryMaxHeap>::Comparator;
 
   // Second parameter is used to satisfy EnhancedBucketPQ interface
-  explicit BinaryMaxHeap(const IDType& storage_initializer,
-                         const KeyType& UNUSED(unused) = 0) :
+  explicit DaryMaxHeap(const IDType& storage_initializer,
+                       const KeyType& UNUSED(unused) = 0) :
     Base(storage_initializer) { }
 
-  friend void swap(BinaryMaxHeap& a, BinaryMaxHeap& b) {
+  friend void swap(DaryMaxHeap& a, DaryMaxHeap& b) {
     using std::swap;
     swap(static_cast<Base&>(a), static_cast<Base&>(b));
   }
@@ -364,21 +465,22 @@ class BinaryMaxHeap final : public BinaryHeapBase<BinaryMaxHeap<IDType_, KeyType
   }
 };
 
-template <typename IDType_, typename KeyType_>
-class BinaryMinHeap final : public BinaryHeapBase<BinaryMinHeap<IDType_, KeyType_> >{
-  using Base = BinaryHeapBase<BinaryMinHeap<IDType_, KeyType_> >;
+template <typename IDType_, typename KeyType_, size_t arity_ = 2>
+class DaryMinHeap final : public BinaryHeapBase<DaryMinHeap<IDType_, KeyType_, arity_> >{
+  using Base = BinaryHeapBase<DaryMinHeap<IDType_, KeyType_, arity_> >;
   friend Base;
 
  public:
-  using IDType = typename BinaryHeapTraits<BinaryMinHeap>::IDType;
-  using KeyType = typename BinaryHeapTraits<BinaryMinHeap>::KeyType;
+  using IDType = typename BinaryHeapTraits<DaryMinHeap>::IDType;
+  using KeyType = typename BinaryHeapTraits<DaryMinHeap>::KeyType;
+  using Comparator = typename BinaryHeapTraits<DaryMinHeap>::Comparator;
 
   // Second parameter is used to satisfy EnhancedBucketPQ interface
-  explicit BinaryMinHeap(const IDType& storage_initializer,
-                         const KeyType& UNUSED(unused) = 0) :
+  explicit DaryMinHeap(const IDType& storage_initializer,
+                       const KeyType& UNUSED(unused) = 0) :
     Base(storage_initializer) { }
 
-  friend void swap(BinaryMinHeap& a, BinaryMinHeap& b) {
+  friend void swap(DaryMinHeap& a, DaryMinHeap& b) {
     using std::swap;
     swap(static_cast<Base&>(a), static_cast<Base&>(b));
   }
@@ -395,11 +497,12 @@ class BinaryMinHeap final : public BinaryHeapBase<BinaryMinHeap<IDType_, KeyType
 
 
 // Traits specialization for max heap:
-template <typename IDType_, typename KeyType_>
-class BinaryHeapTraits<BinaryMaxHeap<IDType_, KeyType_> >{
+template <typename IDType_, typename KeyType_, size_t arity_>
+class BinaryHeapTraits<DaryMaxHeap<IDType_, KeyType_, arity_> >{
  public:
   using IDType = IDType_;
   using KeyType = KeyType_;
+  static constexpr size_t arity = arity_;
   using Comparator = std::less<KeyType>;
 
   static constexpr KeyType sentinel() {
@@ -408,16 +511,23 @@ class BinaryHeapTraits<BinaryMaxHeap<IDType_, KeyType_> >{
 };
 
 // Traits specialization for min heap:
-template <typename IDType_, typename KeyType_>
-class BinaryHeapTraits<BinaryMinHeap<IDType_, KeyType_> >{
+template <typename IDType_, typename KeyType_, size_t arity_>
+class BinaryHeapTraits<DaryMinHeap<IDType_, KeyType_, arity_> >{
  public:
   using IDType = IDType_;
   using KeyType = KeyType_;
+  static constexpr size_t arity = arity_;
   using Comparator = std::greater<KeyType>;
 
   static constexpr KeyType sentinel() {
     return std::numeric_limits<KeyType_>::lowest();
   }
 };
+
+template <typename IDType, typename KeyType>
+using BinaryMaxHeap = DaryMaxHeap<IDType, KeyType, 2>;
+
+template <typename IDType, typename KeyType>
+using BinaryMinHeap = DaryMinHeap<IDType, KeyType, 2>;
 }  // namespace ds
 }  // namespace kahypar
@@ -21,6 +21,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -28,6 +31,7 @@
 
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
+#include "kahypar/utils/math.h"
 
 namespace kahypar {
 namespace ds {
@@ -36,67 +40,186 @@ template <typename PartitionID = Mandatory,
 class ConnectivitySets final {
  private:
   using Byte = char;
+  using Bitset = uint64_t;
 
  public:
+  // ! Hypergraphs with at most kMaxBitsetBlocks blocks store each connectivity
+  // ! set as a single 64-bit word. For larger k, the contained blocks are
+  // ! stored in an array.
+  static constexpr PartitionID kMaxBitsetBlocks = std::numeric_limits<Bitset>::digits;
+
+  // Iterates either over the contained parts of the array representation
+  // or over the set bits of the bitset representation (in ascending order).
+  class Iterator {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PartitionID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PartitionID*;
+    using reference = PartitionID;
+
+    Iterator(const PartitionID* part, const Bitset bitset) :
+      _part(part),
+      _bitset(bitset) { }
+
+    PartitionID operator* () const {
+      return _part != nullptr ? *_part :
+             static_cast<PartitionID>(math::countTrailingZeros(_bitset));
+    }
+
+    Iterator& operator++ () {
+      if (_part != nullptr) {
+        ++_part;
+      } else {
+        _bitset &= _bitset - 1;
+      }
+      return *this;
+    }
+
+    Iterator operator++ (int) {
+      Iterator copy = *this;
+      operator++ ();
+      return copy;
+    }
+
+    bool operator== (const Iterator& rhs) const {
+      return _part == rhs._part && _bitset == rhs._bitset;
+    }
+
+    bool operator!= (const Iterator& rhs) const {
+      return !operator== (rhs);
+    }
+
+ private:
+    const PartitionID* _part;
+    Bitset _bitset;
+  };
+
   // Internal structure for connectivity sets.
-  // Each contains the size of the connectivity set as  the header
-  // and afterwards the _dense and sparse arrays and the partition pin counts.
-  // This memory is allocated outside the structure using a memory arena.
+  // Either a bitset of the contained parts (k <= 64) or an array of the
+  // contained parts. Both representations share the same memory, the bitset
+  // representation is marked by its capacity.
   class ConnectivitySet {
+ private:
+    static constexpr PartitionID kBitsetRepresentation = -1;
+
  public:
-    explicit ConnectivitySet() :
-      _contained_parts() { }
+    explicit ConnectivitySet(const bool use_bitset = false) :
+      _bitset(0),
+      _size(0),
+      _capacity(use_bitset ? kBitsetRepresentation : 0) {
+      if (!use_bitset) {
+        _contained_parts = nullptr;
+      }
+    }
 
     ConnectivitySet(const ConnectivitySet&) = delete;
     ConnectivitySet& operator= (const ConnectivitySet&) = delete;
 
-    ConnectivitySet(ConnectivitySet&&) = default;
+    ConnectivitySet(ConnectivitySet&& other) noexcept :
+      _bitset(0),
+      _size(other._size),
+      _capacity(other._capacity) {
+      if (other.usesBitset()) {
+        _bitset = other._bitset;
+      } else {
+        _contained_parts = other._contained_parts;
+        other._contained_parts = nullptr;
+        other._size = 0;
+        other._capacity = 0;
+      }
+    }
+
     ConnectivitySet& operator= (ConnectivitySets&) = delete;
 
-    ~ConnectivitySet() = default;
+    ~ConnectivitySet() {
+      if (!usesBitset()) {
+        delete[] _contained_parts;
+      }
+    }
 
-    const PartitionID* begin()  const {
-      return _contained_parts.data();
+    Iterator begin()  const {
+      return usesBitset() ? Iterator(nullptr, _bitset) : Iterator(_contained_parts, 0);
     }
 
-    const PartitionID* end() const {
-      return _contained_parts.data() + _contained_parts.size();
+    Iterator end() const {
+      return usesBitset() ? Iterator(nullptr, 0) : Iterator(_contained_parts + _size, 0);
     }
 
     bool contains(const PartitionID value) const {
-      return std::find(_contained_parts.begin(), _contained_parts.end(), value) != _contained_parts.end();
+      if (usesBitset()) {
+        ASSERT(value >= 0 && value < kMaxBitsetBlocks, V(value));
+        return (_bitset >> value) & 1;
+      }
+      return std::find(_contained_parts, _contained_parts + _size, value) != _contained_parts + _size;
     }
 
     void add(const PartitionID value) {
-      ASSERT(std::find(_contained_parts.begin(), _contained_parts.end(), value) == _contained_parts.end());
-      _contained_parts.push_back(value);
+      ASSERT(!contains(value), V(value));
+      if (usesBitset()) {
+        _bitset |= Bitset(1) << value;
+        return;
+      }
+      if (_size == _capacity) {
+        grow();
+      }
+      _contained_parts[_size++] = value;
     }
 
     void remove(const PartitionID value) {
-      ASSERT(std::find(_contained_parts.begin(), _contained_parts.end(), value) != _contained_parts.end());
-      auto it = std::find(_contained_parts.begin(), _contained_parts.end(), value);
-
-      if (it != _contained_parts.end()) {
-        std::swap(*it, _contained_parts.back());
+      ASSERT(contains(value), V(value));
+      if (usesBitset()) {
+        _bitset &= ~(Bitset(1) << value);
+        return;
       }
-      _contained_parts.pop_back();
+      PartitionID* it = std::find(_contained_parts, _contained_parts + _size, value);
+      std::swap(*it, _contained_parts[_size - 1]);
+      --_size;
     }
 
     void clear() {
-      _contained_parts.clear();
+      if (usesBitset()) {
+        _bitset = 0;
+      } else {
+        _size = 0;
+      }
     }
 
     PartitionID size() const {
-      return _contained_parts.size();
+      return usesBitset() ? math::popcount(_bitset) : _size;
+    }
+
+    size_t memoryConsumption() const {
+      return usesBitset() ? 0 : _capacity * sizeof(PartitionID);
     }
 
  private:
-    std::vector<PartitionID> _contained_parts;
+    bool usesBitset() const {
+      return _capacity == kBitsetRepresentation;
+    }
+
+    void grow() {
+      const PartitionID capacity = std::max<PartitionID>(2 * _capacity, 4);
+      PartitionID* contained_parts = new PartitionID[capacity];
+      std::copy(_contained_parts, _contained_parts + _size, contained_parts);
+      delete[] _contained_parts;
+      _contained_parts = contained_parts;
+      _capacity = capacity;
+    }
+
+    union {
+      Bitset _bitset;
+      PartitionID* _contained_parts;
+    };
+    PartitionID _size;
+    PartitionID _capacity;
   };
 
 
-  explicit ConnectivitySets(const HyperedgeID num_hyperedges) :
-    _connectivity_sets(num_hyperedges) { }
+  ConnectivitySets(const HyperedgeID num_hyperedges, const PartitionID k) :
+    _connectivity_sets() {
+    initialize(num_hyperedges, k);
+  }
 
   ConnectivitySets() :
     _connectivity_sets() { }
@@ -111,13 +234,26 @@ class ConnectivitySets final {
 
   ConnectivitySets& operator= (ConnectivitySets&& other) = default;
 
-  void initialize(const HyperedgeID num_hyperedges) {
-    _connectivity_sets.resize(num_hyperedges);
+  void initialize(const HyperedgeID num_hyperedges, const PartitionID k) {
+    ASSERT(_connectivity_sets.empty());
+    const bool use_bitset = k <= kMaxBitsetBlocks;
+    _connectivity_sets.reserve(num_hyperedges);
+    for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+      _connectivity_sets.emplace_back(use_bitset);
+    }
   }
 
-  void resize(const HyperedgeID num_hyperedges) {
+  void resize(const HyperedgeID num_hyperedges, const PartitionID k) {
     _connectivity_sets.clear();
-    initialize(num_hyperedges);
+    initialize(num_hyperedges, k);
+  }
+
+  size_t memoryConsumption() const {
+    size_t memory = _connectivity_sets.capacity() * sizeof(ConnectivitySet);
+    for (const ConnectivitySet& connectivity_set : _connectivity_sets) {
+      memory += connectivity_set.memoryConsumption();
+    }
+    return memory;
   }
 
   const ConnectivitySet& operator[] (const HyperedgeID he) const {
@@ -27,24 +27,26 @@
 #include <limits>
 #include <vector>
 
+#include "kahypar/datastructure/scratch_memory.h"
 #include "kahypar/macros.h"
 
 // based on http://upcoder.com/9/fast-resettable-flag-vector/
 
 namespace kahypar {
 namespace ds {
+// The flags are timestamps in an array leased from the ScratchMemory of the thread.
+// Thus constructing a flag array of the same size as a previously destroyed one
+// takes O(1) time.
 template <typename UnderlyingType = std::uint16_t>
 class FastResetFlagArray {
  public:
   explicit FastResetFlagArray(const size_t size) :
-    _v(std::make_unique<UnderlyingType[]>(size)),
-    _threshold(1),
-    _size(size) {
-    memset(_v.get(), 0, size * sizeof(UnderlyingType));
-  }
+    _v(ScratchArray<UnderlyingType>::stamped(size)),
+    _threshold(_v.generation()),
+    _size(size) { }
 
   FastResetFlagArray() :
-    _v(nullptr),
+    _v(),
     _threshold(1),
     _size(0) { }
 
@@ -58,8 +60,9 @@ class FastResetFlagArray {
 
   void swap(FastResetFlagArray& other) {
     using std::swap;
-    swap(_v, other._v);
+    _v.swap(other._v);
     swap(_threshold, other._threshold);
+    swap(_size, other._size);
   }
 
   bool operator[] (const size_t i) const {
@@ -72,19 +75,22 @@ class FastResetFlagArray {
 
   void reset() {
     if (_threshold == std::numeric_limits<UnderlyingType>::max()) {
-      for (size_t i = 0; i != _size; ++i) {
-        _v[i] = 0;
-      }
-      _threshold = 0;
+      _v.resetStamps();
+      _threshold = 1;
+    } else {
+      ++_threshold;
+      _v.setGeneration(_threshold);
     }
-    ++_threshold;
   }
 
   void setSize(const size_t size, const bool initialiser = false) {
-    ASSERT(_v == nullptr, "Error");
-    _v = std::make_unique<UnderlyingType[]>(size);
+    ASSERT(_v.get() == nullptr, "Error");
+    _v = ScratchArray<UnderlyingType>::stamped(size);
+    _threshold = _v.generation();
     _size = size;
-    memset(_v.get(), (initialiser ? 1 : 0), size * sizeof(UnderlyingType));
+    if (initialiser) {
+      std::fill(_v.get(), _v.get() + size, _threshold);
+    }
   }
 
  private:
@@ -92,7 +98,7 @@ class FastResetFlagArray {
     return _v[i] == _threshold;
   }
 
-  std::unique_ptr<UnderlyingType[]> _v;
+  ScratchArray<UnderlyingType> _v;
   UnderlyingType _threshold;
   size_t _size;
 };
@@ -0,0 +1,368 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "kahypar/datastructure/hash_table.h"
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+#include "kahypar/utils/math.h"
+
+namespace kahypar {
+namespace ds {
+// Open addressing hash map in the style of SwissTable. The table is divided into groups
+// of 16 slots. For each slot, a control byte stores whether the slot is empty or deleted,
+// or 7 bits of the hash of its key. A lookup compares the control bytes of a
+// whole group at once (using SSE2 if available) and only compares the keys of slots
+// whose control byte matches.
+//
+// The map has the same interface as SparseMap: the elements are stored densely in
+// insertion order and can be iterated via begin() and end(), clear() takes time linear
+// in the number of elements and the memory only depends on the number of elements,
+// not on the size of the key universe. Thus it can be used instead of SparseMap for
+// temporary accumulation if the number of distinct keys is small compared to the
+// key universe.
+template <typename Key = Mandatory,
+          typename Value = Mandatory,
+          typename Hash = SimpleHash<Key> >
+class FlatHashMap {
+ private:
+  using Slot = uint32_t;
+  using ControlByte = int8_t;
+  using BitMask = uint32_t;
+
+  static constexpr size_t kGroupSize = 16;
+  static constexpr size_t kMinCapacity = kGroupSize;
+  static constexpr ControlByte kEmpty = static_cast<ControlByte>(0x80);
+  static constexpr ControlByte kDeleted = static_cast<ControlByte>(0xFE);
+
+  struct MapElement {
+    Key key;
+    Value value;
+  };
+
+ public:
+  // max_size is an upper bound for the number of elements and only used to bound
+  // the initial capacity. The table grows if necessary.
+  explicit FlatHashMap(const size_t max_size = 0, const Value UNUSED(initial_value) = 0) :
+    _capacity(0),
+    _size(0),
+    _num_deleted(0),
+    _control(),
+    _slots(),
+    _slot_of_element(),
+    _dense(),
+    _hash() {
+    allocate(std::min(std::max(max_size, kMinCapacity), kInitialCapacity));
+  }
+
+  FlatHashMap(const FlatHashMap&) = delete;
+  FlatHashMap& operator= (const FlatHashMap&) = delete;
+
+  FlatHashMap(FlatHashMap&&) = default;
+  FlatHashMap& operator= (FlatHashMap&&) = default;
+
+  ~FlatHashMap() = default;
+
+  size_t size() const {
+    return _size;
+  }
+
+  bool empty() const {
+    return _size == 0;
+  }
+
+  size_t capacity() const {
+    return _capacity;
+  }
+
+  bool contains(const Key key) const {
+    return find(key) != kInvalidSlot;
+  }
+
+  void add(const Key key, const Value value) {
+    const uint64_t h = hash(key);
+    const Position position = findPosition(key, h);
+    if (!position.found) {
+      insert(key, value, h, position.slot);
+    }
+  }
+
+  const MapElement* begin() const {
+    return _dense.get();
+  }
+
+  const MapElement* end() const {
+    return _dense.get() + _size;
+  }
+
+  MapElement* begin() {
+    return _dense.get();
+  }
+
+  MapElement* end() {
+    return _dense.get() + _size;
+  }
+
+  void clear() {
+    if (_num_deleted > 0 || _size > _capacity / 8) {
+      std::memset(_control.get(), kEmpty, _capacity);
+    } else {
+      for (size_t i = 0; i < _size; ++i) {
+        _control[_slot_of_element[i]] = kEmpty;
+      }
+    }
+    _size = 0;
+    _num_deleted = 0;
+  }
+
+  Value& operator[] (const Key key) {
+    const uint64_t h = hash(key);
+    const Position position = findPosition(key, h);
+    if (position.found) {
+      return _dense[_slots[position.slot]].value;
+    }
+    return insert(key, Value(), h, position.slot);
+  }
+
+  const Value & get(const Key key) const {
+    ASSERT(contains(key), V(key));
+    return _dense[_slots[find(key)]].value;
+  }
+
+  void remove(const Key key) {
+    const Slot slot = find(key);
+    if (slot == kInvalidSlot) {
+      return;
+    }
+    // Move the last element to the position of the removed one
+    const size_t index = _slots[slot];
+    const size_t last = _size - 1;
+    if (index != last) {
+      _dense[index] = _dense[last];
+      _slot_of_element[index] = _slot_of_element[last];
+      _slots[_slot_of_element[index]] = index;
+    }
+    _control[slot] = kDeleted;
+    ++_num_deleted;
+    --_size;
+  }
+
+  size_t memoryConsumption() const {
+    return _capacity * (sizeof(ControlByte) + sizeof(Slot)) +
+           maxSize(_capacity) * (sizeof(MapElement) + sizeof(Slot));
+  }
+
+ private:
+  static constexpr Slot kInvalidSlot = std::numeric_limits<Slot>::max();
+  static constexpr size_t kInitialCapacity = 1024;
+
+  // Maximum load factor of 7/8
+  static size_t maxSize(const size_t capacity) {
+    return capacity - capacity / 8;
+  }
+
+  uint64_t hash(const Key key) const {
+    // Fibonacci hashing to distribute the bits of weak hash functions
+    return static_cast<uint64_t>(_hash(key)) * 0x9E3779B97F4A7C15ULL;
+  }
+
+  static ControlByte h2(const uint64_t hash) {
+    return static_cast<ControlByte>(hash >> 57);
+  }
+
+  size_t firstGroup(const uint64_t hash) const {
+    // The upper bits of the product are independent of the fingerprint bits
+    return (hash >> 25) & (_capacity / kGroupSize - 1);
+  }
+
+  // Returns a bit mask of all slots in the group starting at first_slot
+  // whose control byte is equal to value.
+  BitMask match(const size_t first_slot, const ControlByte value) const {
+#if defined(__SSE2__)
+    const __m128i group = _mm_load_si128(reinterpret_cast<const __m128i*>(_control.get() + first_slot));
+    return static_cast<BitMask>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), group)));
+#else
+    BitMask mask = 0;
+    for (size_t i = 0; i < kGroupSize; ++i) {
+      mask |= static_cast<BitMask>(_control[first_slot + i] == value) << i;
+    }
+    return mask;
+#endif
+  }
+
+  struct Position {
+    Slot slot;
+    bool found;
+  };
+
+  Slot find(const Key key) const {
+    const Position position = findPosition(key, hash(key));
+    return position.found ? position.slot : kInvalidSlot;
+  }
+
+  // Returns the slot of the key, if it is contained in the map. Otherwise, returns
+  // the first free slot on the probe sequence of the key. Since the load factor
+  // is bounded, each probe sequence ends in a group containing an empty slot.
+  Position findPosition(const Key key, const uint64_t hash) const {
+    const ControlByte fingerprint = h2(hash);
+    const size_t group_mask = _capacity / kGroupSize - 1;
+    size_t group = firstGroup(hash);
+    Slot free_slot = kInvalidSlot;
+    // Triangular probing visits each group exactly once, since the number of groups
+    // is a power of two.
+    for (size_t i = 1; ; ++i) {
+      const size_t first_slot = group * kGroupSize;
+      for (BitMask candidates = match(first_slot, fingerprint); candidates != 0;
+           candidates &= candidates - 1) {
+        const Slot slot = first_slot + math::countTrailingZeros(candidates);
+        if (_dense[_slots[slot]].key == key) {
+          return Position { slot, true };
+        }
+      }
+      if (_num_deleted > 0 && free_slot == kInvalidSlot) {
+        const BitMask deleted = match(first_slot, kDeleted);
+        if (deleted != 0) {
+          free_slot = first_slot + math::countTrailingZeros(deleted);
+        }
+      }
+      const BitMask empty = match(first_slot, kEmpty);
+      if (empty != 0) {
+        if (free_slot == kInvalidSlot) {
+          free_slot = first_slot + math::countTrailingZeros(empty);
+        }
+        return Position { free_slot, false };
+      }
+      ASSERT(i <= group_mask, "Hash map overflowed");
+      group = (group + i) & group_mask;
+    }
+  }
+
+  // Inserts a key that is not contained in the map into the given free slot
+  Value& insert(const Key key, const Value value, const uint64_t hash, Slot slot) {
+    ASSERT(!contains(key), V(key));
+    if (_size + _num_deleted + 1 > maxSize(_capacity)) {
+      rehash(_size + 1 > maxSize(_capacity) / 2 ? 2 * _capacity : _capacity);
+      slot = findFreeSlot(hash);
+    } else if (_control[slot] == kDeleted) {
+      --_num_deleted;
+    }
+    _control[slot] = h2(hash);
+    _slots[slot] = _size;
+    _slot_of_element[_size] = slot;
+    _dense[_size] = MapElement { key, value };
+    return _dense[_size++].value;
+  }
+
+  // Returns the first empty slot on the probe sequence. Only used while rebuilding
+  // the table, i.e., if there are no deleted slots.
+  Slot findFreeSlot(const uint64_t hash) const {
+    ASSERT(_num_deleted == 0);
+    const size_t group_mask = _capacity / kGroupSize - 1;
+    size_t group = firstGroup(hash);
+    for (size_t i = 1; ; ++i) {
+      const size_t first_slot = group * kGroupSize;
+      const BitMask empty = match(first_slot, kEmpty);
+      if (empty != 0) {
+        return first_slot + math::countTrailingZeros(empty);
+      }
+      ASSERT(i <= group_mask, "Hash map overflowed");
+      group = (group + i) & group_mask;
+    }
+  }
+
+  void allocate(const size_t min_capacity) {
+    _capacity = kMinCapacity;
+    while (_capacity < min_capacity) {
+      _capacity *= 2;
+    }
+    _control.reset(static_cast<ControlByte*>(alignedAlloc(_capacity)));
+    std::memset(_control.get(), kEmpty, _capacity);
+    _slots = std::make_unique<Slot[]>(_capacity);
+    _slot_of_element = std::make_unique<Slot[]>(maxSize(_capacity));
+    _dense = std::make_unique<MapElement[]>(maxSize(_capacity));
+    _num_deleted = 0;
+  }
+
+  // Rebuilds the table with the given capacity. Elements keep their position
+  // in the dense array.
+  void rehash(const size_t new_capacity) {
+    std::unique_ptr<MapElement[]> dense = std::move(_dense);
+    const size_t size = _size;
+    allocate(new_capacity);
+    std::copy(dense.get(), dense.get() + size, _dense.get());
+    for (size_t i = 0; i < size; ++i) {
+      const uint64_t h = hash(_dense[i].key);
+      const Slot slot = findFreeSlot(h);
+      _control[slot] = h2(h);
+      _slots[slot] = i;
+      _slot_of_element[i] = slot;
+    }
+  }
+
+  // Control bytes are loaded group-wise with aligned loads
+  static void* alignedAlloc(const size_t size) {
+    void* ptr = nullptr;
+#if defined(_MSC_VER)
+    ptr = _aligned_malloc(size, kGroupSize);
+#else
+    if (posix_memalign(&ptr, kGroupSize, size) != 0) {
+      ptr = nullptr;
+    }
+#endif
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  struct AlignedDeleter {
+    void operator() (ControlByte* ptr) const {
+#if defined(_MSC_VER)
+      _aligned_free(ptr);
+#else
+      free(ptr);
+#endif
+    }
+  };
+
+  size_t _capacity;
+  size_t _size;
+  size_t _num_deleted;
+  std::unique_ptr<ControlByte[], AlignedDeleter> _control;
+  std::unique_ptr<Slot[]> _slots;
+  std::unique_ptr<Slot[]> _slot_of_element;
+  std::unique_ptr<MapElement[]> _dense;
+  Hash _hash;
+};
+}  // namespace ds
+}  // namespace kahypar
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <algorithm>
+#include <iostream>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -627,7 +627,7 @@ class GenericHypergraph {
     _fixed_vertex_part_id(),
     _part_info(_k),
     _pins_in_part(static_cast<size_t>(_num_hyperedges) * k),
-    _connectivity_sets(_num_hyperedges),
+    _connectivity_sets(_num_hyperedges, _k),
     _hes_not_containing_u(_num_hyperedges) {
     VertexID edge_vector_index = 0;
     for (HyperedgeID i = 0; i < _num_hyperedges; ++i) {
@@ -1085,63 +1085,20 @@ class GenericHypergraph {
   * \param memento Memento remembering the contraction operation that should be reverted
   */
   void uncontract(const Memento& memento) {
-    ASSERT(!hypernode(memento.u).isDisabled(), "Hypernode" << memento.u << "is disabled");
-    ASSERT(hypernode(memento.v).isDisabled(), "Hypernode" << memento.v << "is not invalid");
-
-    restoreMemento(memento);
-    markIncidentNetsOf(memento.v);
-
-    const auto& incident_hes_of_u = hypernode(memento.u).incidentNets();
-    size_t incident_hes_end = incident_hes_of_u.size();
-
-    for (size_t incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
-      const HyperedgeID he = incident_hes_of_u[incident_hes_it];
-      if (_hes_not_containing_u[he]) {
-        // ... then we have to do some kind of restore operation.
-        if (hyperedge(he).firstInvalidEntry() < hyperedge(he + 1).firstEntry() &&
-            _incidence_array[hyperedge(he).firstInvalidEntry()] == memento.v) {
-          // hyperedge(he + 1) always exists because of sentinel
-          // Undo case 1 operation (i.e. Pin v was just cut off by decreasing size of HE e)
-          DBG << V(he) << " -> case 1";
-          DBG << "increasing size of HE" << he;
-          ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
-          hyperedge(he).incrementSize();
-          incrementPinCountInPart(he, partID(memento.v));
-          ASSERT(_incidence_array[hyperedge(he).firstInvalidEntry() - 1] == memento.v,
-                 "Incorrect case 1 restore of HE" << he << ": "
-                                                  << _incidence_array[hyperedge(he).firstInvalidEntry() - 1] << "!=" << memento.v
-                                                  << "(while uncontracting: (" << memento.u << "," << memento.v << "))");
-
-          if (connectivity(he) > 1) {
-            ++hypernode(memento.v).num_incident_cut_hes;     // because v is connected to that cut HE
-          }
-
-          ++_current_num_pins;
-        } else {
-          std::swap(hypernode(memento.u).incidentNets()[incident_hes_it], hypernode(memento.u).incidentNets().back());
-          hypernode(memento.u).incidentNets().pop_back();
-          --incident_hes_it;
-          --incident_hes_end;
-          // Undo case 2 opeations (i.e. Entry of pin v in HE e was reused to store connection to u):
-          // Set incidence entry containing u for this HE e back to v, because this slot was used
-          // to store the new edge to representative u during contraction as u was not a pin of e.
-          DBG << V(he) << " -> case 2";
-          DBG << "resetting reused Pinslot of HE" << he << "from" << memento.u << "to" << memento.v;
-          resetReusedPinSlotToOriginalValue(he, memento);
-
-          if (connectivity(he) > 1) {
-            --hypernode(memento.u).num_incident_cut_hes;    // because u is not connected to that cut HE anymore
-            ++hypernode(memento.v).num_incident_cut_hes;    // because v is connected to that cut HE
-          }
-        }
-      }
-    }
-    restoreRepresentative(memento);
+    undoContraction<true>(memento);
+  }
 
-    ASSERT(hypernode(memento.u).num_incident_cut_hes == numIncidentCutHEs(memento.u),
-           V(memento.u) << V(hypernode(memento.u).num_incident_cut_hes) << V(numIncidentCutHEs(memento.u)));
-    ASSERT(hypernode(memento.v).num_incident_cut_hes == numIncidentCutHEs(memento.v),
-           V(memento.v) << V(hypernode(memento.v).num_incident_cut_hes) << V(numIncidentCutHEs(memento.v)));
+  /*!
+   * Undoes a contraction operation of a hypergraph without a partition (see
+   * resetPartitioning). Only the incidence structure is restored, i.e., neither
+   * block IDs nor pin counts, connectivity sets or cut hyperedges are maintained.
+   * This allows to restore the input hypergraph in one pass and to assign the
+   * partition only once afterwards.
+   *
+   * \param memento Memento remembering the contraction operation that should be reverted
+   */
+  void uncontractUnpartitioned(const Memento& memento) {
+    undoContraction<false>(memento);
   }
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void restoreMemento(const Memento& memento) {
@@ -1150,15 +1107,7 @@ class GenericHypergraph {
     ++_current_num_hypernodes;
     hypernode(memento.v).part_id = hypernode(memento.u).part_id;
     ++_part_info[partID(memento.u)].size;
-    if (isFixedVertex(memento.u)) {
-      if (!isFixedVertex(memento.v)) {
-        _part_info[fixedVertexPartID(memento.u)].fixed_vertex_weight -= hypernode(memento.v).weight();
-        _fixed_vertex_total_weight -= hypernode(memento.v).weight();
-      } else {
-        ASSERT(_fixed_vertices, "Fixed Vertices data structure not initialized");
-        _fixed_vertices->add(memento.v);
-      }
-    }
+    restoreFixedVertex(memento);
 
     ASSERT(partID(memento.v) != kInvalidPartition,
            "PartitionID" << partID(memento.u) << "of representative HN" << memento.u <<
@@ -1467,7 +1416,7 @@ class GenericHypergraph {
     _k = k;
     _pins_in_part.resize(static_cast<size_t>(_num_hyperedges) * k, 0);
     _part_info.resize(k, PartInfo());
-    _connectivity_sets.resize(_num_hyperedges);
+    _connectivity_sets.resize(_num_hyperedges, k);
   }
 
   void setType(const Type type) {
@@ -1478,6 +1427,21 @@ class GenericHypergraph {
     return typeToString(type());
   }
 
+  // ! Bytes held by the hypernode and hyperedge arrays and the incidence array
+  size_t incidenceStructureMemoryConsumption() const {
+    return _hypernodes.capacity() * sizeof(Hypernode) +
+           _hyperedges.capacity() * sizeof(Hyperedge) +
+           _incidence_array.capacity() * sizeof(VertexID);
+  }
+
+  // ! Bytes held by the partition-dependent data structures
+  // ! (pins in part, part infos and connectivity sets)
+  size_t partitionMemoryConsumption() const {
+    return _pins_in_part.capacity() * sizeof(HypernodeID) +
+           _part_info.capacity() * sizeof(PartInfo) +
+           _connectivity_sets.memoryConsumption();
+  }
+
   HyperedgeID nodeDegree(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
     return hypernode(u).size();
@@ -1946,6 +1910,91 @@ class GenericHypergraph {
     ++_current_num_hyperedges;
   }
 
+  // ! Undoes a contraction operation. If the hypergraph is partitioned, the
+  // ! block IDs, pin counts and cut hyperedges are updated accordingly.
+  template <bool partitioned>
+  void undoContraction(const Memento& memento) {
+    ASSERT(!hypernode(memento.u).isDisabled(), "Hypernode" << memento.u << "is disabled");
+    ASSERT(hypernode(memento.v).isDisabled(), "Hypernode" << memento.v << "is not invalid");
+
+    if (partitioned) {
+      restoreMemento(memento);
+    } else {
+      ASSERT(partID(memento.u) == kInvalidPartition, "Hypernode" << memento.u << "is partitioned");
+      hypernode(memento.v).enable();
+      ++_current_num_hypernodes;
+      restoreFixedVertex(memento);
+    }
+    markIncidentNetsOf(memento.v);
+
+    const auto& incident_hes_of_u = hypernode(memento.u).incidentNets();
+    size_t incident_hes_end = incident_hes_of_u.size();
+
+    for (size_t incident_hes_it = 0; incident_hes_it != incident_hes_end; ++incident_hes_it) {
+      const HyperedgeID he = incident_hes_of_u[incident_hes_it];
+      if (_hes_not_containing_u[he]) {
+        // ... then we have to do some kind of restore operation.
+        if (hyperedge(he).firstInvalidEntry() < hyperedge(he + 1).firstEntry() &&
+            _incidence_array[hyperedge(he).firstInvalidEntry()] == memento.v) {
+          // hyperedge(he + 1) always exists because of sentinel
+          // Undo case 1 operation (i.e. Pin v was just cut off by decreasing size of HE e)
+          DBG << V(he) << " -> case 1";
+          DBG << "increasing size of HE" << he;
+          ASSERT(!hyperedge(he).isDisabled(), "Hyperedge" << he << "is disabled");
+          hyperedge(he).incrementSize();
+          if (partitioned) {
+            incrementPinCountInPart(he, partID(memento.v));
+          }
+          ASSERT(_incidence_array[hyperedge(he).firstInvalidEntry() - 1] == memento.v,
+                 "Incorrect case 1 restore of HE" << he << ": "
+                                                  << _incidence_array[hyperedge(he).firstInvalidEntry() - 1] << "!=" << memento.v
+                                                  << "(while uncontracting: (" << memento.u << "," << memento.v << "))");
+
+          if (partitioned && connectivity(he) > 1) {
+            ++hypernode(memento.v).num_incident_cut_hes;     // because v is connected to that cut HE
+          }
+
+          ++_current_num_pins;
+        } else {
+          std::swap(hypernode(memento.u).incidentNets()[incident_hes_it], hypernode(memento.u).incidentNets().back());
+          hypernode(memento.u).incidentNets().pop_back();
+          --incident_hes_it;
+          --incident_hes_end;
+          // Undo case 2 opeations (i.e. Entry of pin v in HE e was reused to store connection to u):
+          // Set incidence entry containing u for this HE e back to v, because this slot was used
+          // to store the new edge to representative u during contraction as u was not a pin of e.
+          DBG << V(he) << " -> case 2";
+          DBG << "resetting reused Pinslot of HE" << he << "from" << memento.u << "to" << memento.v;
+          resetReusedPinSlotToOriginalValue(he, memento);
+
+          if (partitioned && connectivity(he) > 1) {
+            --hypernode(memento.u).num_incident_cut_hes;    // because u is not connected to that cut HE anymore
+            ++hypernode(memento.v).num_incident_cut_hes;    // because v is connected to that cut HE
+          }
+        }
+      }
+    }
+    restoreRepresentative(memento);
+
+    ASSERT(!partitioned || hypernode(memento.u).num_incident_cut_hes == numIncidentCutHEs(memento.u),
+           V(memento.u) << V(hypernode(memento.u).num_incident_cut_hes) << V(numIncidentCutHEs(memento.u)));
+    ASSERT(!partitioned || hypernode(memento.v).num_incident_cut_hes == numIncidentCutHEs(memento.v),
+           V(memento.v) << V(hypernode(memento.v).num_incident_cut_hes) << V(numIncidentCutHEs(memento.v)));
+  }
+
+  // ! Restores the fixed vertex information of the contraction partner from the given memento.
+  void restoreFixedVertex(const Memento& memento) {
+    if (isFixedVertex(memento.u)) {
+      if (!isFixedVertex(memento.v)) {
+        _part_info[fixedVertexPartID(memento.u)].fixed_vertex_weight -= hypernode(memento.v).weight();
+        _fixed_vertex_total_weight -= hypernode(memento.v).weight();
+      } else {
+        ASSERT(_fixed_vertices, "Fixed Vertices data structure not initialized");
+        _fixed_vertices->add(memento.v);
+      }
+    }
+  }
+
   // ! Restores the representative hypernode from the given memento.
   void restoreRepresentative(const Memento& memento) {
     ASSERT(!hypernode(memento.u).isDisabled(), "Hypernode" << memento.u << "is disabled");
@@ -2344,7 +2393,7 @@ reindex(const Hypergraph& hypergraph) {
   reindexed_hypergraph->_pins_in_part.resize(static_cast<size_t>(num_hyperedges) * hypergraph._k);
   reindexed_hypergraph->_hes_not_containing_u.setSize(num_hyperedges);
 
-  reindexed_hypergraph->_connectivity_sets.initialize(num_hyperedges);
+  reindexed_hypergraph->_connectivity_sets.initialize(num_hyperedges, hypergraph._k);
 
   for (HypernodeID i = 0; i < num_hypernodes - 1; ++i) {
     reindexed_hypergraph->hypernode(i).setWeight(hypergraph.nodeWeight(reindexed_to_original[i]));
@@ -2409,8 +2458,10 @@ extractPartAsUnpartitionedHypergraphForBisection(const Hypergraph& hypergraph,
 
     HyperedgeID num_hyperedges = 0;
     HypernodeID pin_index = 0;
-    if (objective == Objective::km1) {
+    if (objective == Objective::km1 || objective == Objective::soed) {
       // Cut-Net Splitting is used to optimize connectivity-1 metric.
+      // The soed metric is optimized via the same recursive bisection
+      // scheme, since it only differs from km1 by the cut.
       for (const HyperedgeID& he : hypergraph.edges()) {
         ASSERT(hypergraph.edgeSize(he) > 1, V(he));
         if (hypergraph.connectivity(he) == 1 && *hypergraph.connectivitySet(he).begin() != part) {
@@ -2491,7 +2542,7 @@ static void setupInternalStructure(const Hypergraph& reference,
                                      static_cast<size_t>(new_k));
   subhypergraph._hes_not_containing_u.setSize(num_hyperedges);
 
-  subhypergraph._connectivity_sets.initialize(num_hyperedges);
+  subhypergraph._connectivity_sets.initialize(num_hyperedges, new_k);
 
   subhypergraph._part_info.resize(new_k);
 
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace ds {
+template <typename T>
+class ScratchArray;
+
+// Thread-local pool of memory blocks backing SparseSet, SparseMap and FastResetFlagArray.
+// Rating, refinement and extraction data structures are instantiated for each
+// level of recursive bisection and for each V-cycle. Instead of allocating and
+// initializing O(n) memory each time, they lease a block that was returned by
+// a previous instance of the same size.
+//
+// There are two kinds of blocks:
+// - raw blocks are zero-initialized on allocation and contain arbitrary values
+//   of previous leases afterwards. They are used for the sparse set representation
+//   of Briggs and Torczon, which does not require initialization.
+// - stamped blocks belong to arrays of timestamps of a fixed width. Each block has
+//   a generation that is at least as large as every timestamp stored in it. Leasing
+//   a stamped block increments its generation, which invalidates all timestamps in O(1).
+class ScratchMemory {
+  template <typename T>
+  friend class ScratchArray;
+
+  struct Block {
+    std::unique_ptr<uint8_t[]> data;
+    size_t bytes;
+    // sizeof the timestamp type for stamped blocks, 0 for raw blocks
+    size_t stamp_size;
+    uint64_t generation;
+  };
+
+ public:
+  ScratchMemory(const ScratchMemory&) = delete;
+  ScratchMemory(ScratchMemory&&) = delete;
+  ScratchMemory& operator= (const ScratchMemory&) = delete;
+  ScratchMemory& operator= (ScratchMemory&&) = delete;
+
+  ~ScratchMemory() {
+    isDestroyed() = true;
+  }
+
+  static ScratchMemory & instance() {
+    static thread_local ScratchMemory instance;
+    return instance;
+  }
+
+  // Frees all blocks that are currently not leased.
+  void release() {
+    _free_blocks.clear();
+  }
+
+  size_t numFreeBlocks() const {
+    return _free_blocks.size();
+  }
+
+  size_t freeBytes() const {
+    size_t bytes = 0;
+    for (const auto& block : _free_blocks) {
+      bytes += block->bytes;
+    }
+    return bytes;
+  }
+
+ private:
+  ScratchMemory() :
+    _free_blocks() { }
+
+  // Blocks may be returned after the pool of the thread was destroyed,
+  // e.g. by objects with static storage duration.
+  static bool& isDestroyed() {
+    static thread_local bool destroyed = false;
+    return destroyed;
+  }
+
+  // Returns the smallest free block of the requested kind that provides at least
+  // bytes bytes. To bound the memory held by the pool, blocks that are more than
+  // twice as large as requested are not reused.
+  std::unique_ptr<Block> lease(const size_t bytes, const size_t stamp_size) {
+    size_t best = _free_blocks.size();
+    for (size_t i = 0; i < _free_blocks.size(); ++i) {
+      const Block& block = *_free_blocks[i];
+      if (block.stamp_size == stamp_size && block.bytes >= bytes && block.bytes <= 2 * bytes &&
+          (best == _free_blocks.size() || block.bytes < _free_blocks[best]->bytes)) {
+        best = i;
+      }
+    }
+    if (best == _free_blocks.size()) {
+      std::unique_ptr<Block> block(new Block { std::make_unique<uint8_t[]>(bytes), bytes,
+                                               stamp_size, 0 });
+      return block;
+    }
+    std::unique_ptr<Block> block = std::move(_free_blocks[best]);
+    _free_blocks[best] = std::move(_free_blocks.back());
+    _free_blocks.pop_back();
+    return block;
+  }
+
+  static void giveBack(std::unique_ptr<Block> block) {
+    if (!isDestroyed()) {
+      instance()._free_blocks.push_back(std::move(block));
+    }
+  }
+
+  std::vector<std::unique_ptr<Block> > _free_blocks;
+};
+
+// Array leased from the ScratchMemory of the current thread. The memory is returned
+// to the pool of the thread that destroys the array.
+template <typename T>
+class ScratchArray {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Scratch arrays are not initialized and only hold trivial types");
+  using Block = ScratchMemory::Block;
+
+ public:
+  ScratchArray() :
+    _block(nullptr),
+    _data(nullptr),
+    _size(0) { }
+
+  // Raw array whose entries have arbitrary values
+  explicit ScratchArray(const size_t size) :
+    ScratchArray(size, 0) { }
+
+  // Array of timestamps. After leasing, all entries are smaller than generation().
+  static ScratchArray stamped(const size_t size) {
+    static_assert(std::is_integral<T>::value, "Timestamps have to be integral");
+    ScratchArray array(size, sizeof(T));
+    ++array._block->generation;
+    if (array._block->generation > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+      array.resetStamps();
+    }
+    return array;
+  }
+
+  ScratchArray(const ScratchArray&) = delete;
+  ScratchArray& operator= (const ScratchArray&) = delete;
+
+  ScratchArray(ScratchArray&& other) :
+    _block(std::move(other._block)),
+    _data(other._data),
+    _size(other._size) {
+    other._data = nullptr;
+    other._size = 0;
+  }
+
+  ScratchArray& operator= (ScratchArray&& other) {
+    if (this != &other) {
+      giveBack();
+      _block = std::move(other._block);
+      _data = other._data;
+      _size = other._size;
+      other._data = nullptr;
+      other._size = 0;
+    }
+    return *this;
+  }
+
+  ~ScratchArray() {
+    giveBack();
+  }
+
+  T* get() const {
+    return _data;
+  }
+
+  T& operator[] (const size_t i) {
+    return _data[i];
+  }
+
+  const T& operator[] (const size_t i) const {
+    return _data[i];
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  T generation() const {
+    ASSERT(_block != nullptr && _block->stamp_size == sizeof(T));
+    return static_cast<T>(_block->generation);
+  }
+
+  // Has to be called whenever timestamps larger than the current generation are written.
+  void setGeneration(const T generation) {
+    ASSERT(_block != nullptr && _block->stamp_size == sizeof(T));
+    _block->generation = static_cast<uint64_t>(generation);
+  }
+
+  // Sets all timestamps of the block to zero and the generation to one.
+  void resetStamps() {
+    ASSERT(_block != nullptr && _block->stamp_size == sizeof(T));
+    std::memset(_block->data.get(), 0, _block->bytes);
+    _block->generation = 1;
+  }
+
+  void swap(ScratchArray& other) {
+    using std::swap;
+    swap(_block, other._block);
+    swap(_data, other._data);
+    swap(_size, other._size);
+  }
+
+ private:
+  ScratchArray(const size_t size, const size_t stamp_size) :
+    _block(ScratchMemory::instance().lease(size * sizeof(T), stamp_size)),
+    _data(reinterpret_cast<T*>(_block->data.get())),
+    _size(size) { }
+
+  void giveBack() {
+    if (_block != nullptr) {
+      ScratchMemory::giveBack(std::move(_block));
+      _data = nullptr;
+      _size = 0;
+    }
+  }
+
+  std::unique_ptr<Block> _block;
+  T* _data;
+  size_t _size;
+};
+}  // namespace ds
+}  // namespace kahypar
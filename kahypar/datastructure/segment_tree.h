@@ -55,7 +55,53 @@ public:
     return query_rec(0, 0, _size-1, i, j);
   }
 
+  // Has to be called after the i-th element of the sequence changed.
+  // Time O(log(n)).
+  void update(const size_t i) {
+    ASSERT(i < _size, "Invalid index:" << V(i));
+    update_rec(0, 0, _size-1, i);
+  }
+
+  // Returns the smallest index i such that PRED(query(i, i)) holds or the size of
+  // the sequence if there is no such index. PRED has to be monotone with respect to
+  // COMBINE, i.e., PRED(COMBINE(v1, v2)) implies PRED(v1) or PRED(v2).
+  // Time O(log(n)).
+  template<typename Predicate>
+  size_t findFirst(const Predicate& pred) const {
+    return _size > 0 ? findFirst_rec(0, 0, _size-1, pred) : _size;
+  }
+
 private:
+  tree_type value(const size_t pos, const size_t cur_i, const size_t cur_j) const {
+    return (cur_i == cur_j) ? BASE(cur_i, _seq, _param) : _seg_tree[pos];
+  }
+
+  tree_type update_rec(const size_t pos, const size_t cur_i, const size_t cur_j, const size_t i) {
+    if (cur_i == cur_j) {
+      return BASE(cur_i, _seq, _param);
+    }
+    size_t m = (cur_i+cur_j)/2;
+    if (i <= m) {
+      _seg_tree[pos] = COMBINE(update_rec(2*pos+1, cur_i, m, i), value(2*pos+2, m+1, cur_j), _param);
+    } else {
+      _seg_tree[pos] = COMBINE(value(2*pos+1, cur_i, m), update_rec(2*pos+2, m+1, cur_j, i), _param);
+    }
+    return _seg_tree[pos];
+  }
+
+  template<typename Predicate>
+  size_t findFirst_rec(const size_t pos, const size_t cur_i, const size_t cur_j, const Predicate& pred) const {
+    if (!pred(value(pos, cur_i, cur_j))) {
+      return _size;
+    }
+    if (cur_i == cur_j) {
+      return cur_i;
+    }
+    size_t m = (cur_i+cur_j)/2;
+    const size_t left = findFirst_rec(2*pos+1, cur_i, m, pred);
+    return left < _size ? left : findFirst_rec(2*pos+2, m+1, cur_j, pred);
+  }
+
     tree_type query_rec(const size_t pos, const size_t cur_i, const size_t cur_j, const size_t qry_i, const size_t qry_j) const {
       ASSERT(cur_j >= cur_i && qry_j >= qry_i, "Invalid query.");
       if (cur_i >= qry_i && cur_j <= qry_j) {
@@ -31,6 +31,7 @@
 #include <utility>
 #include <vector>
 
+#include "kahypar/datastructure/scratch_memory.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
 
@@ -101,18 +102,14 @@ class SparseMapBase {
   }
 
  protected:
+  // The sparse set representation does not require the arrays to be initialized.
+  // Therefore they are leased from the ScratchMemory of the thread.
   explicit SparseMapBase(const size_t max_size,
-                         const Value initial_value = 0) :
+                         const Value UNUSED(initial_value) = 0) :
     _size(0),
-    _sparse(std::make_unique<size_t[]>((max_size * sizeof(MapElement) +
-                                        max_size * sizeof(size_t)) / sizeof(size_t))),
-    _dense(nullptr) {
-    _dense = reinterpret_cast<MapElement*>(_sparse.get() + max_size);
-    for (size_t i = 0; i < max_size; ++i) {
-      _sparse[i] = std::numeric_limits<size_t>::max();
-      _dense[i] = MapElement { std::numeric_limits<Key>::max(), initial_value };
-    }
-  }
+    _sparse((max_size * sizeof(MapElement) +
+             max_size * sizeof(size_t)) / sizeof(size_t)),
+    _dense(reinterpret_cast<MapElement*>(_sparse.get() + max_size)) { }
 
   ~SparseMapBase() = default;
 
@@ -121,12 +118,11 @@ class SparseMapBase {
     _sparse(std::move(other._sparse)),
     _dense(std::move(other._dense)) {
     other._size = 0;
-    other._sparse = nullptr;
     other._dense = nullptr;
   }
 
   size_t _size;
-  std::unique_ptr<size_t[]> _sparse;
+  ScratchArray<size_t> _sparse;
   MapElement* _dense;
 };
 
@@ -153,7 +149,6 @@ class SparseMap final : public SparseMapBase<Key, Value, SparseMap<Key, Value> >
     _size = 0;
     _dense = std::move(other._dense);
     other._size = 0;
-    other._sparse = nullptr;
     other._dense = nullptr;
     return *this;
   }
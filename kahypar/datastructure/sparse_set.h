@@ -29,6 +29,7 @@
 #include <memory>
 #include <utility>
 
+#include "kahypar/datastructure/scratch_memory.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
 
@@ -76,15 +77,12 @@ class SparseSetBase {
   }
 
  protected:
+  // The sparse set representation does not require the arrays to be initialized.
+  // Therefore they are leased from the ScratchMemory of the thread.
   explicit SparseSetBase(const ValueType k) :
     _size(0),
-    _sparse(std::make_unique<ValueType[]>(2 * static_cast<size_t>(k))),
-    _dense(nullptr) {
-    for (ValueType i = 0; i < 2 * k; ++i) {
-      _sparse[i] = std::numeric_limits<ValueType>::max();
-    }
-    _dense = _sparse.get() + k;
-  }
+    _sparse(2 * static_cast<size_t>(k)),
+    _dense(_sparse.get() + k) { }
 
   ~SparseSetBase() = default;
 
@@ -93,12 +91,11 @@ class SparseSetBase {
     _sparse(std::move(other._sparse)),
     _dense(other._dense) {
     other._size = 0;
-    other._sparse = nullptr;
     other._dense = nullptr;
   }
 
   ValueType _size;
-  std::unique_ptr<ValueType[]> _sparse;
+  ScratchArray<ValueType> _sparse;
   ValueType* _dense;
 };
 
@@ -169,7 +166,11 @@ class InsertOnlySparseSet final : public SparseSetBase<ValueType,
  public:
   explicit InsertOnlySparseSet(const ValueType k) :
     Base(k),
-    _threshold(0) { }
+    _threshold(0) {
+    for (ValueType i = 0; i < k; ++i) {
+      _sparse[i] = std::numeric_limits<ValueType>::max();
+    }
+  }
 
   InsertOnlySparseSet(const InsertOnlySparseSet&) = delete;
 
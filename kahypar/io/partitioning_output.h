@@ -33,6 +33,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/utils/math.h"
+#include "kahypar/utils/perf_counters.h"
 #include "kahypar/utils/timer.h"
 
 namespace kahypar {
@@ -216,6 +217,26 @@ inline void printQualityOfInitialSolution(const Hypergraph& hypergraph, const Co
   }
 }
 
+inline void printPerfCounters() {
+  LOG << "\nHardware Performance Counters:";
+  LOG << "(regions are inclusive, i.e., phases contain the counts of the kernels they execute)";
+  for (size_t i = 0; i < static_cast<size_t>(PerfRegion::COUNT); ++i) {
+    const PerfRegion region = static_cast<PerfRegion>(i);
+    const PerfCounterValues& values = PerfCounters::instance().values(region);
+    if (values.calls == 0) {
+      continue;
+    }
+    LOG << "  +" << region << ":"
+        << "calls=" << values.calls
+        << "cycles=" << values.cycles
+        << "instructions=" << values.instructions
+        << "IPC=" << (values.cycles > 0 ?
+                      static_cast<double>(values.instructions) / values.cycles : 0.0)
+        << "llc_misses=" << values.llc_misses
+        << "branch_misses=" << values.branch_misses;
+  }
+}
+
 inline void printPartitioningResults(const Hypergraph& hypergraph,
                                      const Context& context,
                                      const std::chrono::duration<double>& elapsed_seconds) {
@@ -234,6 +255,7 @@ inline void printPartitioningResults(const Hypergraph& hypergraph,
     LOG << "Partition time                     =" << elapsed_seconds.count() << "s";
     if (!context.partition_evolutionary && !context.partition.time_limited_repeated_partitioning) {
       LOG << "  + Preprocessing                  =" << timings.total_preprocessing << "s";
+      LOG << "    | node reordering              =" << timings.pre_node_reordering << "s";
       LOG << "    | min hash sparsifier          =" << timings.pre_sparsifier << "s";
       LOG << "    | community detection          =" << timings.pre_community_detection << "s";
       LOG << "  + Coarsening                     =" << timings.total_coarsening << "s";
@@ -294,6 +316,11 @@ inline void printPartitioningResults(const Hypergraph& hypergraph,
     if (!context.partition_evolutionary && !context.partition.time_limited_repeated_partitioning) {
       LOG << "  + Postprocessing                 =" << timings.total_postprocessing << "s";
       LOG << "    | undo sparsifier              =" << timings.post_sparsifier_restore << "s";
+      LOG << "    | undo node reordering         =" << timings.post_node_reordering_restore << "s";
+    }
+
+    if (context.partition.perf_counters) {
+      printPerfCounters();
     }
     LOG << "";
   }
@@ -416,8 +443,7 @@ static inline void printLocalSearchResults(const Context& context, const Hypergr
   if (!context.partition.quiet_mode && context.partition.verbose_output && context.type == ContextType::main) {
     LOG << "Local Search Result:";
     LOG << "Final" << context.partition.objective << "      ="
-        << (context.partition.objective == Objective::cut ? metrics::hyperedgeCut(hypergraph) :
-        metrics::km1(hypergraph));
+        << metrics::objective(hypergraph, context.partition.objective);
     LOG << "Final imbalance =" << metrics::imbalance(hypergraph, context);
     LOG << "Final part sizes and weights:";
     io::printPartSizesAndWeights(hypergraph);
@@ -31,6 +31,7 @@
 #include "kahypar/partition/evolutionary/individual.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/partitioner.h"
+#include "kahypar/utils/memory.h"
 
 namespace kahypar {
 namespace io {
@@ -64,8 +65,12 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
       << " algorithm=" << algo_name.str()
       << " graph=" << context.partition.graph_filename.substr(context.partition.graph_filename.find_last_of('/') + 1)
       << " interrupted=" << (interrupted ? "yes" : "no")
-      << " timeout=" << (context.partition.time_limit_triggered ? "yes" : "no")
-      << " numHNs=" << hypergraph.initialNumNodes()
+      << " timeout=" << (context.partition.time_limit_triggered ? "yes" : "no");
+  for (size_t i = 0; i < static_cast<size_t>(TimeLimitPhase::COUNT); ++i) {
+    oss << " timeout_" << static_cast<TimeLimitPhase>(i) << "="
+        << ((*context.partition.time_limited_phases)[i] ? "yes" : "no");
+  }
+  oss << " numHNs=" << hypergraph.initialNumNodes()
       << " numHEs=" << hypergraph.initialNumEdges()
       << " " << hypergraph.typeAsString();
   if (!context.partition.fixed_vertex_filename.empty()) {
@@ -99,6 +104,7 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
 
   oss << " pre_enable_deduplication=" << std::boolalpha
       << context.preprocessing.enable_deduplication
+      << " pre_node_ordering=" << context.preprocessing.node_ordering
       << " pre_enable_min_hash_sparsifier=" << std::boolalpha
       << context.preprocessing.enable_min_hash_sparsifier
       << " pre_min_hash_max_hyperedge_size="
@@ -181,7 +187,9 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
         << context.initial_partitioning.local_search.fm.adaptive_stopping_alpha;
   }
   oss << " local_search_algorithm=" << context.local_search.algorithm
-      << " local_search_iterations_per_level=" << context.local_search.iterations_per_level;
+      << " local_search_iterations_per_level=" << context.local_search.iterations_per_level
+      << " local_search_uncontraction_batch_size=" << context.local_search.uncontraction_batch_size
+      << " local_search_fast_projection=" << std::boolalpha << context.local_search.fast_projection;
   if (context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
       context.local_search.algorithm == RefinementAlgorithm::kway_fm ||
       context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1) {
@@ -216,17 +224,20 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
     // we're assuming the external interruption comes from an external timeout which is as long as the internally set time limit
     oss << " totalPartitionTime=" << context.partition.time_limit;
   }
+  oss << " peakRSS=" << memory::peakRSS();
 
   // These detailed timings don't make sense in memetic mode
   if (!context.partition_evolutionary &&
       !context.partition.time_limited_repeated_partitioning) {
-    oss << " minHashSparsifierTime=" << timings.pre_sparsifier
+    oss << " nodeReorderingTime=" << timings.pre_node_reordering
+        << " minHashSparsifierTime=" << timings.pre_sparsifier
         << " communityDetectionTime=" << timings.pre_community_detection
         << " coarseningTime=" << timings.total_coarsening
         << " initialPartitionTime=" << timings.total_initial_partitioning
         << " uncoarseningRefinementTime=" << timings.total_local_search
         << " flowTime=" << timings.total_flow_refinement
-        << " postMinHashSparsifierTime=" << timings.post_sparsifier_restore;
+        << " postMinHashSparsifierTime=" << timings.post_sparsifier_restore
+        << " postNodeReorderingTime=" << timings.post_node_reordering_restore;
   }
 
   if (context.partition.global_search_iterations > 0) {
@@ -293,6 +304,8 @@ static inline void serializeEvolutionary(const Context& context, const Hypergrap
       << " absorption=" << metrics::absorption(hg)
       << " imbalance=" << metrics::imbalance(hg, context)
       << " k=" << context.partition.k
+      << " population-memory=" << context.evolutionary.population_memory
+      << " peakRSS=" << memory::peakRSS()
       << std::endl;
 
   std::cout << oss.str() << std::endl;
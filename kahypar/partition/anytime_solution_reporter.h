@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
+
+namespace kahypar {
+// Keeps track of the best partition of the input hypergraph found so far and
+// hands each improving partition to the ImprovedSolutionCallback of the context.
+// Solutions are reported at the end of each partitioning call (including each
+// repetition of time-limited repeated partitioning and each individual of the
+// evolutionary algorithm) as well as after the initial multilevel cycle and each
+// V-cycle of direct k-way partitioning. Intermediate solutions of sub-hypergraphs
+// (recursive bisection, initial partitioning, sparsified, reordered or deduplicated
+// hypergraphs) are ignored, since they are not partitions of the input hypergraph.
+class AnytimeSolutionReporter {
+ public:
+  AnytimeSolutionReporter(const Hypergraph& hypergraph, const ImprovedSolutionCallback& callback) :
+    _hypergraph(hypergraph),
+    _callback(callback),
+    _partition(hypergraph.initialNumNodes(), Hypergraph::kInvalidPartition),
+    _objective(0),
+    _imbalance(0.0),
+    _is_feasible(false),
+    _num_solutions(0) { }
+
+  AnytimeSolutionReporter(const AnytimeSolutionReporter&) = delete;
+  AnytimeSolutionReporter& operator= (const AnytimeSolutionReporter&) = delete;
+
+  AnytimeSolutionReporter(AnytimeSolutionReporter&&) = delete;
+  AnytimeSolutionReporter& operator= (AnytimeSolutionReporter&&) = delete;
+
+  ~AnytimeSolutionReporter() = default;
+
+  void report(const Hypergraph& hypergraph, const Context& context) {
+    if (&hypergraph != &_hypergraph || context.type != ContextType::main ||
+        hypergraph.currentNumNodes() != hypergraph.initialNumNodes()) {
+      return;
+    }
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      if (hypergraph.partID(hn) == Hypergraph::kInvalidPartition) {
+        return;
+      }
+    }
+
+    const HyperedgeWeight objective = metrics::correctMetric(hypergraph, context);
+    const double imbalance = metrics::imbalance(hypergraph, context);
+    bool is_feasible = true;
+    for (PartitionID part = 0; part != context.partition.k; ++part) {
+      is_feasible &= hypergraph.partWeight(part) <= context.partition.max_part_weights[part];
+    }
+
+    if (!isImprovement(objective, imbalance, is_feasible)) {
+      return;
+    }
+
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      _partition[hn] = hypergraph.partID(hn);
+    }
+    _objective = objective;
+    _imbalance = imbalance;
+    _is_feasible = is_feasible;
+    ++_num_solutions;
+    _callback(_partition, _objective, _imbalance);
+  }
+
+  const std::vector<PartitionID> & bestPartition() const {
+    return _partition;
+  }
+
+  size_t numReportedSolutions() const {
+    return _num_solutions;
+  }
+
+ private:
+  // Feasible solutions are always preferred over infeasible ones.
+  bool isImprovement(const HyperedgeWeight objective, const double imbalance,
+                     const bool is_feasible) const {
+    if (_num_solutions == 0 || is_feasible != _is_feasible) {
+      return _num_solutions == 0 || is_feasible;
+    }
+    return objective < _objective || (objective == _objective && imbalance < _imbalance);
+  }
+
+  const Hypergraph& _hypergraph;
+  const ImprovedSolutionCallback _callback;
+  std::vector<PartitionID> _partition;
+  HyperedgeWeight _objective;
+  double _imbalance;
+  bool _is_feasible;
+  size_t _num_solutions;
+};
+
+static inline void reportAnytimeSolution(const Hypergraph& hypergraph, const Context& context) {
+  if (context.partition.anytime_reporter != nullptr) {
+    context.partition.anytime_reporter->report(hypergraph, context);
+  }
+}
+
+// Writes the partition to a temporary file that is then renamed to filename.
+// Therefore, filename always contains a complete partition, even if the process
+// is killed while writing. If writing fails, filename is left unchanged.
+static inline void writePartitionFileAtomically(const std::vector<PartitionID>& partition,
+                                                const std::string& filename) {
+  const std::string tmp_filename = filename + ".tmp";
+  {
+    std::ofstream out_stream(tmp_filename.c_str(), std::ios::trunc);
+    for (const PartitionID& part : partition) {
+      out_stream << part << "\n";
+    }
+    out_stream.flush();
+    if (!out_stream.good()) {
+      LOG << "WARNING: could not write partition file" << tmp_filename;
+      out_stream.close();
+      std::remove(tmp_filename.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+    LOG << "WARNING: could not replace partition file" << filename;
+    std::remove(tmp_filename.c_str());
+  }
+}
+}  // namespace kahypar
@@ -20,16 +20,36 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "kahypar/definitions.h"
 #include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/segment_tree.h"
 
 namespace kahypar {
 namespace bin_packing {
 using kahypar::ds::BinaryMinHeap;
 
+namespace internal {
+  // define segment tree that is used for finding the first fitting bin
+  using Bin = std::pair<HypernodeWeight, bool>;
+
+  inline HypernodeWeight bin_min(const HypernodeWeight& v1, const HypernodeWeight& v2, const HypernodeWeight& /*max*/) {
+    return std::min(v1, v2);
+  }
+
+  // locked bins are represented by the maximum weight, i.e., no element fits into them
+  inline HypernodeWeight bin_base(const size_t& i, const std::vector<Bin>& bins, const HypernodeWeight& /*max*/) {
+    return bins[i].second ? std::numeric_limits<HypernodeWeight>::max() : bins[i].first;
+  }
+
+  using BinWeightSegTree = ds::ParametrizedSegmentTree<Bin, HypernodeWeight, bin_min, bin_base>;
+} // namespace internal
+
 /*
 * An (online) bin packing algorithm is represented by a class that holds the internal state
 * and provides methods to insert elements or add initial weight to a bin. Additionally, it
@@ -57,9 +77,11 @@ using kahypar::ds::BinaryMinHeap;
 */
 
 // Worst Fit algorithm - inserts an element to the bin with the lowest weight.
-class WorstFit {
+// BinQueue is an addressable min-priority queue of the bins keyed by their weight.
+template <class BinQueue>
+class GenericWorstFit {
   public:
-    WorstFit(const PartitionID num_bins, const HypernodeWeight /*max*/) :
+    GenericWorstFit(const PartitionID num_bins, const HypernodeWeight /*max*/) :
       _bin_queue(num_bins),
       _weights(),
       _num_bins(num_bins) {
@@ -106,44 +128,54 @@ class WorstFit {
     }
 
   private:
-    BinaryMinHeap<PartitionID, HypernodeWeight> _bin_queue;
+    BinQueue _bin_queue;
     std::vector<HypernodeWeight> _weights;
     PartitionID _num_bins;
 };
 
+using WorstFit = GenericWorstFit<BinaryMinHeap<PartitionID, HypernodeWeight> >;
+
 // First Fit algorithm - inserts an element to the first fitting bin.
-class FirstFit {
+// If there are more than kMaxBinsForLinearScan bins, the first fitting bin is found
+// in logarithmic time via a segment tree over the bin weights. Otherwise, the bins
+// are scanned linearly, which is faster for few bins.
+template <size_t kMaxBinsForLinearScan>
+class GenericFirstFit {
   public:
-    FirstFit(const PartitionID num_bins, const HypernodeWeight max) :
+    GenericFirstFit(const PartitionID num_bins, const HypernodeWeight max) :
       _max_bin_weight(max),
-      _bins(num_bins, {0, false}) { }
+      _bins(num_bins, {0, false}),
+      _bin_tree(createBinTree()) { }
+
+    // The segment tree references the bins and has to be rebuilt for each copy.
+    GenericFirstFit(const GenericFirstFit& other) :
+      _max_bin_weight(other._max_bin_weight),
+      _bins(other._bins),
+      _bin_tree(createBinTree()) { }
+
+    GenericFirstFit(GenericFirstFit&& other) :
+      _max_bin_weight(other._max_bin_weight),
+      _bins(std::move(other._bins)),
+      _bin_tree(createBinTree()) { }
+
+    GenericFirstFit& operator= (const GenericFirstFit&) = delete;
+    GenericFirstFit& operator= (GenericFirstFit&&) = delete;
 
     void addWeight(const PartitionID bin, const HypernodeWeight weight) {
       ASSERT(bin >= 0 && static_cast<size_t>(bin) < _bins.size(), "Invalid bin id: " << V(bin));
 
       _bins[bin].first += weight;
+      updateBinTree(bin);
     }
 
     PartitionID insertElement(const HypernodeWeight weight) {
       ASSERT(weight >= 0, "Negative weight.");
 
-      size_t assigned_bin = 0;
-      for (size_t i = 0; i < _bins.size(); ++i) {
-        if (_bins[i].second) {
-          continue;
-        }
-
-        // The node is assigned to the first fitting bin or, if none fits, the smallest bin.
-        if (_bins[i].first + weight <= _max_bin_weight) {
-          assigned_bin = i;
-          break;
-        } else if (_bins[assigned_bin].second || _bins[i].first < _bins[assigned_bin].first) {
-          assigned_bin = i;
-        }
-      }
+      const size_t assigned_bin = _bin_tree ? firstFitInBinTree(weight) : firstFitInLinearScan(weight);
 
       ASSERT(!_bins[assigned_bin].second, "All available bins are locked.");
       _bins[assigned_bin].first += weight;
+      updateBinTree(assigned_bin);
       return assigned_bin;
     }
 
@@ -152,6 +184,7 @@ class FirstFit {
       ASSERT(!_bins[bin].second, "Bin already locked.");
 
       _bins[bin].second = true;
+      updateBinTree(bin);
     }
 
     HypernodeWeight binWeight(const PartitionID bin) const {
@@ -165,8 +198,57 @@ class FirstFit {
     }
 
   private:
+    std::unique_ptr<internal::BinWeightSegTree> createBinTree() {
+      if (_bins.size() > kMaxBinsForLinearScan) {
+        return std::make_unique<internal::BinWeightSegTree>(_bins, _max_bin_weight);
+      }
+      return nullptr;
+    }
+
+    void updateBinTree(const PartitionID bin) {
+      if (_bin_tree) {
+        _bin_tree->update(bin);
+      }
+    }
+
+    // The node is assigned to the first fitting bin or, if none fits, the smallest bin.
+    size_t firstFitInLinearScan(const HypernodeWeight weight) const {
+      size_t assigned_bin = 0;
+      for (size_t i = 0; i < _bins.size(); ++i) {
+        if (_bins[i].second) {
+          continue;
+        }
+
+        if (_bins[i].first + weight <= _max_bin_weight) {
+          assigned_bin = i;
+          break;
+        } else if (_bins[assigned_bin].second || _bins[i].first < _bins[assigned_bin].first) {
+          assigned_bin = i;
+        }
+      }
+      return assigned_bin;
+    }
+
+    size_t firstFitInBinTree(const HypernodeWeight weight) const {
+      size_t assigned_bin = _bin_tree->findFirst([&](const HypernodeWeight min_weight) {
+          return min_weight <= _max_bin_weight - weight;
+        });
+      if (assigned_bin == _bins.size()) {
+        const HypernodeWeight smallest = _bin_tree->query(0, _bins.size() - 1);
+        assigned_bin = _bin_tree->findFirst([&](const HypernodeWeight min_weight) {
+            return min_weight <= smallest;
+          });
+      }
+      return assigned_bin;
+    }
+
     HypernodeWeight _max_bin_weight;
-    std::vector<std::pair<HypernodeWeight, bool>> _bins;
+    std::vector<internal::Bin> _bins;
+    std::unique_ptr<internal::BinWeightSegTree> _bin_tree;
 };
+
+using FirstFit = GenericFirstFit<32>;
+using LinearFirstFit = GenericFirstFit<std::numeric_limits<size_t>::max()>;
+using BinTreeFirstFit = GenericFirstFit<0>;
 } // namespace bin_packing
 } // namespace kahypar
@@ -210,6 +210,30 @@ static inline std::vector<HypernodeID> nodesInDescendingWeightOrder(const Hyperg
   return nodes;
 }
 
+// Returns the hypernodes that are heavier than min_weight sorted in descending order of weight,
+// i.e., the prefix of nodesInDescendingWeightOrder(hg) that contains these hypernodes (up to the
+// order of hypernodes with equal weight). Only the heavy hypernodes are sorted. The total weight
+// of the remaining hypernodes is stored in light_weight.
+static inline std::vector<HypernodeID> heavyNodesInDescendingWeightOrder(const Hypergraph& hg,
+                                                                         const HypernodeWeight min_weight,
+                                                                         HypernodeWeight& light_weight) {
+  std::vector<HypernodeID> nodes;
+  light_weight = 0;
+  for (const HypernodeID& hn : hg.nodes()) {
+    if (hg.nodeWeight(hn) > min_weight) {
+      nodes.push_back(hn);
+    } else {
+      light_weight += hg.nodeWeight(hn);
+    }
+  }
+
+  std::sort(nodes.begin(), nodes.end(), [&hg](HypernodeID a, HypernodeID b) {
+    return hg.nodeWeight(a) > hg.nodeWeight(b);
+  });
+
+  return nodes;
+}
+
 // Preassigns all fixed vertices of the hypergraph to the packer, using a first fit packing.
 template< class BPAlgorithm >
 static inline void preassignFixedVertices(const Hypergraph& hg, const std::vector<HypernodeID>& nodes, std::vector<PartitionID>& parts,
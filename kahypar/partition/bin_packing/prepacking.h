@@ -183,14 +183,18 @@ static inline void calculateHeuristicPrepacking(Hypergraph& hg, const Context& c
   ASSERT((context.initial_partitioning.upper_allowed_partition_weight.size() == static_cast<size_t>(context.partition.k)) &&
          (context.initial_partitioning.perfect_balance_partition_weight.size() == static_cast<size_t>(context.partition.k)));
 
-  std::vector<HypernodeID> nodes = nodesInDescendingWeightOrder(hg);
   const HypernodeWeight max_bin_weight = context.initial_partitioning.max_allowed_bin_weight;
   const HypernodeWeight allowed_imbalance = max_bin_weight - context.initial_partitioning.current_max_bin_weight;
   ASSERT(allowed_imbalance > 0, "allowed_imbalance is zero!");
 
+  // A node can only cause an imbalance larger than the allowed one if it is heavier than
+  // the allowed imbalance. Therefore, only these nodes need to be sorted.
+  HypernodeWeight light_weight = 0;
+  std::vector<HypernodeID> nodes = heavyNodesInDescendingWeightOrder(hg, allowed_imbalance, light_weight);
+
   // calculate heuristic threshold
   HypernodeID threshold = 0;
-  HypernodeWeight current_lower_sum = 0;
+  HypernodeWeight current_lower_sum = light_weight;
   HypernodeWeight imbalance = 0;
 
   for (int i = nodes.size() - 1; i >= 0; --i) {
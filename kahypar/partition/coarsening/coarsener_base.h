@@ -35,7 +35,11 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/perf_counters.h"
+#include "kahypar/utils/progress.h"
 #include "kahypar/utils/progress_bar.h"
+#include "kahypar/utils/time_limit.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 class CoarsenerBase {
@@ -57,7 +61,14 @@ class CoarsenerBase {
     _max_hn_weights(),
     _hypergraph_pruner(_hg.initialNumNodes()),
     _coarsening_progress_bar(_hg.initialNumNodes(), 0,
-      context.partition.verbose_output && context.type == ContextType::main) {
+      context.partition.verbose_output && context.type == ContextType::main),
+    _trace_levels(),
+    _trace_level_start(),
+    _time_limit_exceeded(false) {
+    if (unlikely(Tracer::instance().isEnabled())) {
+      _trace_levels.push_back(_hg.initialNumNodes());
+      _trace_level_start = std::chrono::high_resolution_clock::now();
+    }
     _history.reserve(_hg.initialNumNodes());
     _max_hn_weights.reserve(_hg.initialNumNodes());
     _max_hn_weights.emplace_back(CurrentMaxNodeWeight { _hg.initialNumNodes(),
@@ -74,7 +85,9 @@ class CoarsenerBase {
 
  protected:
   void performContraction(const HypernodeID rep_node, const HypernodeID contracted_node) {
+    ScopedPerfCounter perf_counter(PerfRegion::contraction);
     _history.emplace_back(_hg.contract(rep_node, contracted_node));
+    perf_counter.stop();
     _coarsening_progress_bar += 1;
     if (_hg.nodeWeight(rep_node) > _max_hn_weights.back().max_weight) {
       _max_hn_weights.emplace_back(CurrentMaxNodeWeight { _hg.currentNumNodes(),
@@ -82,6 +95,63 @@ class CoarsenerBase {
     }
     removeSingleNodeHyperedges();
     removeParallelHyperedges();
+    if (unlikely(Tracer::instance().isEnabled())) {
+      traceCoarseningLevel(false);
+    }
+    if (_history.size() % _context.partition.soft_time_limit_check_frequency == 0) {
+      progress::report(_context, ProgressPhase::coarsening, _history.size(),
+                       _hg.currentNumNodes(), 0);
+    }
+  }
+
+  // The time limit is polled every soft_time_limit_check_frequency contractions.
+  // Once it is exceeded, coarsening stops early.
+  bool coarseningTimeLimitExceeded() {
+    if (!_time_limit_exceeded &&
+        _history.size() % _context.partition.soft_time_limit_check_frequency == 0) {
+      _time_limit_exceeded = time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::coarsening);
+    }
+    return _time_limit_exceeded;
+  }
+
+  // For tracing purposes, a coarsening level ends as soon as the number of
+  // nodes has been halved. The node counts at the beginning of each level
+  // are kept such that uncoarsening can be traced using the same levels.
+  void traceCoarseningLevel(const bool last_level) {
+    if (_trace_levels.empty()) {
+      return;
+    }
+    const HypernodeID level_nodes = _trace_levels.back();
+    if (_hg.currentNumNodes() <= level_nodes / 2 ||
+        (last_level && _hg.currentNumNodes() < level_nodes)) {
+      const HighResClockTimepoint now = std::chrono::high_resolution_clock::now();
+      Tracer::instance().add("coarsening level", "coarsening", _trace_level_start, now,
+                             TraceArgs().add("level", _trace_levels.size() - 1)
+                             .add("nodes_before", level_nodes)
+                             .add("nodes_after", _hg.currentNumNodes()).release());
+      _trace_level_start = now;
+      if (!last_level) {
+        _trace_levels.push_back(_hg.currentNumNodes());
+      }
+    }
+  }
+
+  void startUncoarseningTrace() {
+    while (!_trace_levels.empty() && _trace_levels.back() <= _hg.currentNumNodes()) {
+      _trace_levels.pop_back();
+    }
+    _trace_level_start = std::chrono::high_resolution_clock::now();
+  }
+
+  void traceUncoarseningLevel() {
+    if (!_trace_levels.empty() && _hg.currentNumNodes() >= _trace_levels.back()) {
+      const HighResClockTimepoint now = std::chrono::high_resolution_clock::now();
+      Tracer::instance().add("uncoarsening level", "uncoarsening", _trace_level_start, now,
+                             TraceArgs().add("level", _trace_levels.size() - 1)
+                             .add("nodes", _hg.currentNumNodes()).release());
+      _trace_level_start = now;
+      _trace_levels.pop_back();
+    }
   }
 
   void removeSingleNodeHyperedges() {
@@ -122,31 +192,32 @@ class CoarsenerBase {
 #endif
   }
 
+  template <class ObjectivePolicy>
   void performLocalSearch(IRefiner& refiner, std::vector<HypernodeID>& refinement_nodes,
                           Metrics& current_metrics,
                           const UncontractionGainChanges& changes) {
     ASSERT(changes.representative.size() != 0, "0");
     ASSERT(changes.contraction_partner.size() != 0, "0");
-    bool improvement_found = performLocalSearchIteration(refiner, refinement_nodes, changes,
-                                                         current_metrics);
+    bool improvement_found = performLocalSearchIteration<ObjectivePolicy>(refiner, refinement_nodes,
+                                                                          changes, current_metrics);
     UncontractionGainChanges no_changes;
     no_changes.representative.push_back(0);
     no_changes.contraction_partner.push_back(0);
 
     int iteration = 1;
     while ((iteration < _context.local_search.iterations_per_level) && improvement_found) {
-      improvement_found = performLocalSearchIteration(refiner, refinement_nodes, no_changes,
-                                                      current_metrics);
+      improvement_found = performLocalSearchIteration<ObjectivePolicy>(refiner, refinement_nodes,
+                                                                       no_changes, current_metrics);
       ++iteration;
     }
   }
 
+  template <class ObjectivePolicy>
   bool performLocalSearchIteration(IRefiner& refiner,
                                    std::vector<HypernodeID>& refinement_nodes,
                                    const UncontractionGainChanges& current_changes,
                                    Metrics& current_metrics) {
-    const HyperedgeWeight old_cut = current_metrics.cut;
-    const HyperedgeWeight old_km1 = current_metrics.km1;
+    const HyperedgeWeight old_objective = ObjectivePolicy::value(current_metrics);
     bool improvement_found = refiner.refine(refinement_nodes,
                                             { _context.partition.max_part_weights[0]
                                               + _max_hn_weights.back().max_weight,
@@ -155,21 +226,31 @@ class CoarsenerBase {
                                             current_changes,
                                             current_metrics);
 
-    HEAVY_REFINEMENT_ASSERT((current_metrics.cut <= old_cut && current_metrics.cut == metrics::hyperedgeCut(_hg)) ||
-           (current_metrics.km1 <= old_km1 && current_metrics.km1 == metrics::km1(_hg)),
-           V(current_metrics.cut) << V(old_cut) << V(metrics::hyperedgeCut(_hg))
-                                  << V(current_metrics.km1) << V(old_km1) << V(metrics::km1(_hg)));
+    HEAVY_REFINEMENT_ASSERT(ObjectivePolicy::value(current_metrics) <= old_objective &&
+                            ObjectivePolicy::value(current_metrics) == ObjectivePolicy::compute(_hg),
+                            V(ObjectivePolicy::objective) << V(old_objective)
+                                                          << V(ObjectivePolicy::value(current_metrics))
+                                                          << V(ObjectivePolicy::compute(_hg)));
 
-    DBGC(_context.partition.objective == Objective::cut) << old_cut << "-->" << current_metrics.cut;
-    DBGC(_context.partition.objective == Objective::km1) << old_km1 << "-->" << current_metrics.km1;
+    DBG << ObjectivePolicy::objective << ":" << old_objective << "-->"
+        << ObjectivePolicy::value(current_metrics);
     return improvement_found;
   }
 
+  size_t memoryConsumption() const {
+    return _history.capacity() * sizeof(CoarseningMemento) +
+           _max_hn_weights.capacity() * sizeof(CurrentMaxNodeWeight) +
+           _hypergraph_pruner.memoryConsumption();
+  }
+
   void finalizeProgressBar() {
     const size_t remaining_nodes =
       static_cast<size_t>(_hg.initialNumNodes()) -
       _coarsening_progress_bar.count();
     _coarsening_progress_bar += remaining_nodes;
+    if (unlikely(Tracer::instance().isEnabled())) {
+      traceCoarseningLevel(true);
+    }
   }
 
   Hypergraph& _hg;
@@ -178,5 +259,8 @@ class CoarsenerBase {
   std::vector<CurrentMaxNodeWeight> _max_hn_weights;
   HypergraphPruner _hypergraph_pruner;
   ProgressBar _coarsening_progress_bar;
+  std::vector<HypernodeID> _trace_levels;
+  HighResClockTimepoint _trace_level_start;
+  bool _time_limit_exceeded;
 };
 }  // namespace kahypar
@@ -90,7 +90,8 @@ class FullVertexPairCoarsener final : public ICoarsener,
     // PQ because they are heavier than allowed.
     ds::FastResetFlagArray<> invalid_hypernodes(_hg.initialNumNodes());
 
-    while (!_pq.empty() && _hg.currentNumFreeVertices() > limit) {
+    while (!_pq.empty() && _hg.currentNumFreeVertices() > limit &&
+           !coarseningTimeLimitExceeded()) {
       const HypernodeID rep_node = _pq.top();
       const HypernodeID contracted_node = _target[rep_node];
 
@@ -134,6 +135,10 @@ class FullVertexPairCoarsener final : public ICoarsener,
     return doUncoarsen(refiner);
   }
 
+  size_t memoryConsumptionImpl() const override final {
+    return CoarsenerBase::memoryConsumption();
+  }
+
   void reRateAffectedHypernodes(const HypernodeID rep_node,
                                 ds::FastResetFlagArray<>& rerated_hypernodes,
                                 ds::FastResetFlagArray<>& invalid_hypernodes) {
@@ -280,6 +280,12 @@ class HypergraphPruner {
     return _max_removed_single_node_he_weight;
   }
 
+  size_t memoryConsumption() const {
+    return _removed_single_node_hyperedges.capacity() * sizeof(HyperedgeID) +
+           _removed_parallel_hyperedges.capacity() * sizeof(ParallelHE) +
+           _fingerprints.capacity() * sizeof(Fingerprint);
+  }
+
  private:
   HyperedgeWeight _max_removed_single_node_he_weight;
   std::vector<HyperedgeID> _removed_single_node_hyperedges;
@@ -43,6 +43,18 @@ class ICoarsener {
     return uncoarsenImpl(refiner);
   }
 
+  // Bytes held by the coarsening history and the data structures
+  // needed to undo the contractions.
+  size_t memoryConsumption() const {
+    return memoryConsumptionImpl();
+  }
+
+  // The hypergraph that initial partitioning is performed on. Coarseners that
+  // contract the input hypergraph in place return nullptr.
+  Hypergraph* coarsestHypergraph() {
+    return coarsestHypergraphImpl();
+  }
+
   virtual ~ICoarsener() = default;
 
  protected:
@@ -51,5 +63,7 @@ class ICoarsener {
  private:
   virtual void coarsenImpl(const HypernodeID limit) = 0;
   virtual bool uncoarsenImpl(IRefiner& refiner) = 0;
+  virtual size_t memoryConsumptionImpl() const { return 0; }
+  virtual Hypergraph* coarsestHypergraphImpl() { return nullptr; }
 };
 }  // namespace kahypar
@@ -84,7 +84,8 @@ class LazyVertexPairCoarsener final : public ICoarsener,
 
     Base::rateAllHypernodes(_rater, _target);
 
-    while (!_pq.empty() && _hg.currentNumFreeVertices() > limit) {
+    while (!_pq.empty() && _hg.currentNumFreeVertices() > limit &&
+           !Base::coarseningTimeLimitExceeded()) {
       const HypernodeID rep_node = _pq.top();
 
       if (_outdated_rating[rep_node] || !FixedVertexPolicy::acceptContraction(_hg, _context, rep_node, _target[rep_node])) {
@@ -131,6 +132,10 @@ class LazyVertexPairCoarsener final : public ICoarsener,
     return Base::doUncoarsen(refiner);
   }
 
+  size_t memoryConsumptionImpl() const override final {
+    return CoarsenerBase::memoryConsumption();
+  }
+
   void invalidateAffectedHypernodes(const HypernodeID rep_node) {
     for (const HyperedgeID& he : _hg.incidentEdges(rep_node)) {
       for (const HypernodeID& pin : _hg.pins(he)) {
@@ -79,7 +79,7 @@ class MLCoarsener final : public ICoarsener,
   void coarsenImpl(const HypernodeID limit) override final {
     int pass_nr = 0;
     std::vector<HypernodeID> current_hns;
-    while (_hg.currentNumFreeVertices() > limit) {
+    while (_hg.currentNumFreeVertices() > limit && !coarseningTimeLimitExceeded()) {
       DBG << V(pass_nr);
       DBG << V(_hg.currentNumNodes());
       DBG << V(_hg.currentNumEdges());
@@ -111,7 +111,7 @@ class MLCoarsener final : public ICoarsener,
             // }
           }
 
-          if (_hg.currentNumFreeVertices() <= limit) {
+          if (_hg.currentNumFreeVertices() <= limit || coarseningTimeLimitExceeded()) {
             break;
           }
         }
@@ -130,6 +130,10 @@ class MLCoarsener final : public ICoarsener,
     return doUncoarsen(refiner);
   }
 
+  size_t memoryConsumptionImpl() const override final {
+    return CoarsenerBase::memoryConsumption();
+  }
+
   using Base::_pq;
   using Base::_hg;
   using Base::_context;
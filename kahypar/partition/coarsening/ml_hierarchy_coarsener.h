@@ -0,0 +1,426 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_community_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/coarsening/vertex_pair_rater.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/partition/refinement/refiner_factory.h"
+#include "kahypar/utils/math.h"
+#include "kahypar/utils/perf_counters.h"
+#include "kahypar/utils/progress.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/time_limit.h"
+
+namespace kahypar {
+/*!
+ * Classic multilevel coarsener. In contrast to the n-level coarseners, which contract
+ * the input hypergraph in place one vertex pair at a time, each level is a separate
+ * hypergraph that is built by contracting a clustering of the previous level.
+ * Single-pin hyperedges are dropped and parallel hyperedges are merged during
+ * contraction. Uncoarsening projects the partition level by level and refines each
+ * level once, which trades solution quality for speed and memory.
+ */
+template <class ScorePolicy = HeavyEdgeScore,
+          class HeavyNodePenaltyPolicy = NoWeightPenalty,
+          class CommunityPolicy = UseCommunityStructure,
+          class RatingPartitionPolicy = NormalPartitionPolicy,
+          class AcceptancePolicy = BestRatingPreferringUnmatched<>,
+          class FixedVertexPolicy = AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+          typename RatingType = RatingType>
+class MLHierarchyCoarsener final : public ICoarsener {
+ private:
+  static constexpr bool debug = false;
+
+  static constexpr HypernodeID kInvalidTarget = std::numeric_limits<HypernodeID>::max();
+  // Coarsening stops if a level shrinks the number of hypernodes by less than 1%.
+  static constexpr double kMinShrinkFactor = 0.99;
+
+  using Rater = VertexPairRater<ScorePolicy,
+                                HeavyNodePenaltyPolicy,
+                                CommunityPolicy,
+                                RatingPartitionPolicy,
+                                AcceptancePolicy,
+                                FixedVertexPolicy,
+                                RatingType>;
+  using Rating = typename Rater::Rating;
+
+  struct Level {
+    std::unique_ptr<Hypergraph> hypergraph;
+    // Maps each hypernode of the next finer level to its hypernode in this level.
+    std::vector<HypernodeID> fine_to_coarse;
+  };
+
+ public:
+  MLHierarchyCoarsener(Hypergraph& hypergraph, const Context& context,
+                       const HypernodeWeight) :
+    _hg(hypergraph),
+    _context(context),
+    _levels() { }
+
+  ~MLHierarchyCoarsener() override = default;
+
+  MLHierarchyCoarsener(const MLHierarchyCoarsener&) = delete;
+  MLHierarchyCoarsener& operator= (const MLHierarchyCoarsener&) = delete;
+
+  MLHierarchyCoarsener(MLHierarchyCoarsener&&) = delete;
+  MLHierarchyCoarsener& operator= (MLHierarchyCoarsener&&) = delete;
+
+ private:
+  void coarsenImpl(const HypernodeID limit) override final {
+    _levels.clear();
+    while (coarsestLevel().currentNumFreeVertices() > limit &&
+           !time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::coarsening)) {
+      Hypergraph& fine = coarsestLevel();
+      std::vector<HypernodeID> fine_to_coarse;
+      const HypernodeID num_coarse_nodes = computeClustering(fine, limit, fine_to_coarse);
+      if (num_coarse_nodes > kMinShrinkFactor * fine.currentNumNodes()) {
+        break;
+      }
+      std::unique_ptr<Hypergraph> coarse = contract(fine, fine_to_coarse, num_coarse_nodes);
+      DBG << "Level" << _levels.size() + 1 << ":" << V(coarse->currentNumNodes())
+          << V(coarse->currentNumEdges()) << V(coarse->currentNumPins());
+      _levels.emplace_back(Level { std::move(coarse), std::move(fine_to_coarse) });
+      progress::report(_context, ProgressPhase::coarsening, _levels.size(),
+                       coarsestLevel().currentNumNodes(), 0);
+    }
+  }
+
+  bool uncoarsenImpl(IRefiner& refiner) override final {
+    const HyperedgeWeight initial_objective = metrics::correctMetric(coarsestLevel(), _context);
+    if (_context.type == ContextType::main) {
+      _context.stats.set(StatTag::InitialPartitioning, "initialCut",
+                         metrics::hyperedgeCut(coarsestLevel()));
+      _context.stats.set(StatTag::InitialPartitioning, "initialKm1", metrics::km1(coarsestLevel()));
+      _context.stats.set(StatTag::InitialPartitioning, "initialImbalance",
+                         metrics::imbalance(coarsestLevel(), _context));
+    }
+
+    while (!_levels.empty()) {
+      Hypergraph& coarse = coarsestLevel();
+      std::unique_ptr<IRefiner> level_refiner(RefinerFactory::getInstance().createObject(
+                                                _context.local_search.algorithm, coarse, _context));
+      refineLevel(coarse, *level_refiner);
+      level_refiner.reset();
+
+      Hypergraph& fine = _levels.size() > 1 ? *_levels[_levels.size() - 2].hypergraph : _hg;
+      projectPartition(coarse, fine, _levels.back().fine_to_coarse);
+      _levels.pop_back();
+      // No further progress is reported once the partitioning call is cancelled.
+      if (_context.partition.progress_callback && !progress::isCancellationRequested(_context)) {
+        progress::report(_context, ProgressPhase::uncoarsening, _levels.size(),
+                         fine.currentNumNodes(), metrics::correctMetric(fine, _context));
+      }
+    }
+    refineLevel(_hg, refiner);
+
+    return metrics::correctMetric(_hg, _context) < initial_objective;
+  }
+
+  Hypergraph* coarsestHypergraphImpl() override final {
+    return &coarsestLevel();
+  }
+
+  size_t memoryConsumptionImpl() const override final {
+    size_t memory = 0;
+    for (const Level& level : _levels) {
+      memory += level.hypergraph->incidenceStructureMemoryConsumption() +
+                level.hypergraph->partitionMemoryConsumption() +
+                level.fine_to_coarse.capacity() * sizeof(HypernodeID);
+    }
+    return memory;
+  }
+
+  Hypergraph& coarsestLevel() const {
+    return _levels.empty() ? _hg : *_levels.back().hypergraph;
+  }
+
+  // Clusters the hypernodes of the given level and returns the number of hypernodes
+  // of the contracted level. Each hypernode joins the cluster of its best rated
+  // neighbor, as long as the cluster stays below the maximum allowed node weight and
+  // does not contain fixed vertices of different blocks. If the level is already
+  // partitioned (i.e., during V-cycles), clusters do not span several blocks.
+  HypernodeID computeClustering(Hypergraph& fine, const HypernodeID limit,
+                                std::vector<HypernodeID>& fine_to_coarse) {
+    Rater rater(fine, _context);
+    fine_to_coarse.assign(fine.initialNumNodes(), kInvalidTarget);
+    std::vector<HypernodeWeight> cluster_weight;
+    std::vector<PartitionID> cluster_fixed_part;
+
+    std::vector<HypernodeID> permutation;
+    permutation.reserve(fine.currentNumNodes());
+    for (const HypernodeID& hn : fine.nodes()) {
+      permutation.push_back(hn);
+    }
+    Randomize::instance().shuffleVector(permutation, permutation.size());
+
+    HypernodeID num_free_vertices = fine.currentNumFreeVertices();
+    for (const HypernodeID& hn : permutation) {
+      if (fine_to_coarse[hn] != kInvalidTarget) {
+        continue;
+      }
+      if (num_free_vertices <= limit) {
+        break;
+      }
+      const Rating rating = rater.rate(hn);
+      if (rating.target == kInvalidTarget || fine.partID(hn) != fine.partID(rating.target)) {
+        continue;
+      }
+      HypernodeID cluster = fine_to_coarse[rating.target];
+      if (cluster == kInvalidTarget) {
+        cluster = cluster_weight.size();
+        fine_to_coarse[rating.target] = cluster;
+        cluster_weight.push_back(fine.nodeWeight(rating.target));
+        cluster_fixed_part.push_back(fine.fixedVertexPartID(rating.target));
+        rater.markAsMatched(rating.target);
+      } else if (cluster_weight[cluster] + fine.nodeWeight(hn) >
+                 _context.coarsening.max_allowed_node_weight ||
+                 (fine.isFixedVertex(hn) &&
+                  cluster_fixed_part[cluster] != Hypergraph::kInvalidPartition &&
+                  cluster_fixed_part[cluster] != fine.fixedVertexPartID(hn))) {
+        continue;
+      }
+      if (!fine.isFixedVertex(hn) || cluster_fixed_part[cluster] == Hypergraph::kInvalidPartition) {
+        --num_free_vertices;
+      }
+      fine_to_coarse[hn] = cluster;
+      cluster_weight[cluster] += fine.nodeWeight(hn);
+      if (fine.isFixedVertex(hn)) {
+        cluster_fixed_part[cluster] = fine.fixedVertexPartID(hn);
+      }
+      rater.markAsMatched(hn);
+    }
+
+    HypernodeID num_coarse_nodes = cluster_weight.size();
+    for (const HypernodeID& hn : fine.nodes()) {
+      if (fine_to_coarse[hn] == kInvalidTarget) {
+        fine_to_coarse[hn] = num_coarse_nodes++;
+      }
+    }
+    return num_coarse_nodes;
+  }
+
+  std::unique_ptr<Hypergraph> contract(const Hypergraph& fine,
+                                       const std::vector<HypernodeID>& fine_to_coarse,
+                                       const HypernodeID num_coarse_nodes) {
+    ScopedPerfCounter perf_counter(PerfRegion::contraction);
+    // Hyperedges of the contracted level, possibly containing parallel hyperedges.
+    std::vector<size_t> edge_begin;
+    std::vector<HypernodeID> edge_pins;
+    std::vector<HyperedgeWeight> edge_weight;
+    std::vector<size_t> edge_hash;
+    edge_begin.reserve(fine.currentNumEdges() + 1);
+    edge_pins.reserve(fine.currentNumPins());
+    edge_weight.reserve(fine.currentNumEdges());
+    edge_hash.reserve(fine.currentNumEdges());
+    for (const HyperedgeID& he : fine.edges()) {
+      const size_t begin = edge_pins.size();
+      for (const HypernodeID& pin : fine.pins(he)) {
+        edge_pins.push_back(fine_to_coarse[pin]);
+      }
+      std::sort(edge_pins.begin() + begin, edge_pins.end());
+      edge_pins.erase(std::unique(edge_pins.begin() + begin, edge_pins.end()), edge_pins.end());
+      if (edge_pins.size() - begin < 2) {
+        edge_pins.resize(begin);
+        continue;
+      }
+      size_t hash = 0;
+      for (size_t i = begin; i < edge_pins.size(); ++i) {
+        hash += math::hash(edge_pins[i]);
+      }
+      edge_begin.push_back(begin);
+      edge_weight.push_back(fine.edgeWeight(he));
+      edge_hash.push_back(hash);
+    }
+    edge_begin.push_back(edge_pins.size());
+
+    // Parallel hyperedges have the same hash and size and are therefore adjacent
+    // after sorting. Each of them is merged into the first one of its group.
+    const size_t num_edges = edge_weight.size();
+    auto edge_size = [&](const size_t e) {
+                       return edge_begin[e + 1] - edge_begin[e];
+                     };
+    std::vector<size_t> order(num_edges);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+        return std::make_pair(edge_hash[lhs], edge_size(lhs)) <
+               std::make_pair(edge_hash[rhs], edge_size(rhs));
+      });
+    std::vector<size_t> representative(num_edges);
+    std::iota(representative.begin(), representative.end(), 0);
+    for (size_t group_begin = 0; group_begin < num_edges; ) {
+      size_t group_end = group_begin + 1;
+      while (group_end < num_edges &&
+             edge_hash[order[group_end]] == edge_hash[order[group_begin]] &&
+             edge_size(order[group_end]) == edge_size(order[group_begin])) {
+        ++group_end;
+      }
+      for (size_t i = group_begin + 1; i < group_end; ++i) {
+        const size_t e = order[i];
+        for (size_t j = group_begin; j < i; ++j) {
+          const size_t candidate = order[j];
+          if (representative[candidate] == candidate &&
+              std::equal(edge_pins.begin() + edge_begin[e], edge_pins.begin() + edge_begin[e + 1],
+                         edge_pins.begin() + edge_begin[candidate])) {
+            representative[e] = candidate;
+            edge_weight[candidate] += edge_weight[e];
+            break;
+          }
+        }
+      }
+      group_begin = group_end;
+    }
+
+    HyperedgeIndexVector index_vector;
+    HyperedgeVector edge_vector;
+    HyperedgeWeightVector edge_weights;
+    index_vector.reserve(num_edges + 1);
+    edge_vector.reserve(edge_pins.size());
+    edge_weights.reserve(num_edges);
+    for (size_t e = 0; e < num_edges; ++e) {
+      if (representative[e] == e) {
+        index_vector.push_back(edge_vector.size());
+        edge_vector.insert(edge_vector.end(), edge_pins.begin() + edge_begin[e],
+                           edge_pins.begin() + edge_begin[e + 1]);
+        edge_weights.push_back(edge_weight[e]);
+      }
+    }
+    index_vector.push_back(edge_vector.size());
+
+    HypernodeWeightVector node_weights(num_coarse_nodes, 0);
+    std::vector<PartitionID> communities(num_coarse_nodes, 0);
+    for (const HypernodeID& hn : fine.nodes()) {
+      node_weights[fine_to_coarse[hn]] += fine.nodeWeight(hn);
+      communities[fine_to_coarse[hn]] = fine.communities()[hn];
+    }
+
+    std::unique_ptr<Hypergraph> coarse = std::make_unique<Hypergraph>(
+      num_coarse_nodes, edge_weights.size(), index_vector, edge_vector, fine.k(),
+      &edge_weights, &node_weights);
+    coarse->setCommunities(std::move(communities));
+    for (const HypernodeID& hn : fine.fixedVertices()) {
+      if (!coarse->isFixedVertex(fine_to_coarse[hn])) {
+        coarse->setFixedVertex(fine_to_coarse[hn], fine.fixedVertexPartID(hn));
+      }
+    }
+    for (const HypernodeID& hn : fine.nodes()) {
+      if (fine.partID(hn) != Hypergraph::kInvalidPartition &&
+          coarse->partID(fine_to_coarse[hn]) == Hypergraph::kInvalidPartition) {
+        coarse->setNodePart(fine_to_coarse[hn], fine.partID(hn));
+      }
+    }
+    coarse->initializeNumCutHyperedges();
+    return coarse;
+  }
+
+  void projectPartition(const Hypergraph& coarse, Hypergraph& fine,
+                        const std::vector<HypernodeID>& fine_to_coarse) {
+    ScopedPerfCounter perf_counter(PerfRegion::uncontraction);
+    for (const HypernodeID& hn : fine.nodes()) {
+      const PartitionID part = coarse.partID(fine_to_coarse[hn]);
+      if (fine.partID(hn) == Hypergraph::kInvalidPartition) {
+        fine.setNodePart(hn, part);
+      } else if (fine.partID(hn) != part) {
+        fine.changeNodePart(hn, fine.partID(hn), part);
+      }
+    }
+    fine.initializeNumCutHyperedges();
+  }
+
+  // Runs up to iterations_per_level local searches seeded with all border
+  // hypernodes of the level. Once the time limit is exceeded, partitions are
+  // only projected.
+  void refineLevel(Hypergraph& hypergraph, IRefiner& refiner) {
+    if (time_limit::isSoftTimeLimitExceeded(_context)) {
+      return;
+    }
+    std::vector<HypernodeID> refinement_nodes;
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      if (hypergraph.isBorderNode(hn)) {
+        refinement_nodes.push_back(hn);
+      }
+    }
+    // The 2-way FM refiner expects at least one uncontracted pair of hypernodes.
+    if (refinement_nodes.size() < 2) {
+      return;
+    }
+    initializeRefiner(hypergraph, refiner);
+    UncontractionGainChanges no_changes;
+    no_changes.representative.push_back(0);
+    no_changes.contraction_partner.push_back(0);
+    Metrics current_metrics = { metrics::hyperedgeCut(hypergraph),
+                                metrics::km1(hypergraph),
+                                metrics::imbalance(hypergraph, _context) };
+    const HypernodeWeight heaviest_node_weight = hypergraph.weightOfHeaviestNode();
+    const std::array<HypernodeWeight, 2> max_allowed_part_weights = {
+      _context.partition.max_part_weights[0] + heaviest_node_weight,
+      _context.partition.max_part_weights[1] + heaviest_node_weight
+    };
+    bool improvement_found = true;
+    for (int iteration = 0;
+         iteration < _context.local_search.iterations_per_level && improvement_found;
+         ++iteration) {
+      improvement_found = refiner.refine(refinement_nodes, max_allowed_part_weights,
+                                         no_changes, current_metrics);
+    }
+  }
+
+  void initializeRefiner(const Hypergraph& hypergraph, IRefiner& refiner) {
+#ifdef USE_BUCKET_QUEUE
+    HyperedgeID max_degree = 0;
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      max_degree = std::max(max_degree, hypergraph.nodeDegree(hn));
+    }
+    HyperedgeWeight max_he_weight = 0;
+    for (const HyperedgeID& he : hypergraph.edges()) {
+      max_he_weight = std::max(max_he_weight, hypergraph.edgeWeight(he));
+    }
+    refiner.initialize(static_cast<HyperedgeWeight>(max_degree * max_he_weight));
+#else
+    unused(hypergraph);
+    refiner.initialize(0);
+#endif
+  }
+
+  Hypergraph& _hg;
+  const Context& _context;
+  std::vector<Level> _levels;
+};
+}  // namespace kahypar
@@ -35,6 +35,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/perf_counters.h"
 #include "kahypar/utils/progress_bar.h"
 #include "kahypar/utils/randomize.h"
 #include "kahypar/utils/time_limit.h"
@@ -75,6 +76,9 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
       case Objective::km1:
         initial_objective = current_metrics.km1;
         break;
+      case Objective::soed:
+        initial_objective = current_metrics.cut + current_metrics.km1;
+        break;
       default:
         LOG << "Unknown Objective";
         exit(-1);
@@ -87,50 +91,17 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
                          current_metrics.imbalance);
     }
 
-    CoarsenerBase::initializeRefiner(refiner);
-    std::vector<HypernodeID> refinement_nodes(2, 0);
-    UncontractionGainChanges changes;
-    changes.representative.push_back(0);
-    changes.contraction_partner.push_back(0);
-
-    ProgressBar uncontraction_progress_bar(
-      _hg.initialNumNodes(), current_metrics.getMetric(
-        _context.partition.mode, _context.partition.objective),
-      _context.partition.verbose_output && _context.type == ContextType::main);
-    uncontraction_progress_bar += _hg.currentNumNodes();
-    while (!_history.empty()) {
-      if (time_limit::isSoftTimeLimitExceeded(_context, _history.size())) {
-        /*
-         * There are two ways to implement this time limit.
-         * 1) skip refinement but perform full uncontractions, including updates. This can be slow
-         * 2) only perform the partition projection of the uncontractions. This leaves the dynamic hypergraph in a "broken" state, i.e.
-         * hyperedges are still as in the contracted hypergraph, whereas vertices are unpacked and activated.
-         *
-         * We implement 2) because all considered output measures are either already maintained (i.e. part weights and imbalance)
-         * or can be computed on the state of hyperedges in the contracted hypergraph.
-         * This means, this time limit should not be used to
-         */
-          while (!_history.empty()) {
-            _hg.restoreMemento(_history.back().contraction_memento);
-            _history.pop_back();
-          }
-        break;
-      }
-
-      refinement_nodes.clear();
-      refinement_nodes.push_back(_history.back().contraction_memento.u);
-      refinement_nodes.push_back(_history.back().contraction_memento.v);
-
-      uncontract(changes);
-
-      CoarsenerBase::performLocalSearch(refiner, refinement_nodes, current_metrics, changes);
-      changes.representative[0] = 0;
-      changes.contraction_partner[0] = 0;
-
-      // Update Progress Bar
-      uncontraction_progress_bar += 1;
-      uncontraction_progress_bar.setObjective(current_metrics.getMetric(
-        _context.partition.mode, _context.partition.objective));
+    // The metric optimized by the refiners is dispatched once per uncoarsening, such
+    // that the uncontraction loop does not branch on the objective. In recursive
+    // bisection, km1 and soed are also optimized via the cut net metric.
+    if (_context.partition.mode == Mode::direct_kway &&
+        _context.partition.objective == Objective::km1) {
+      uncoarsenAndRefine<Km1Objective>(refiner, current_metrics);
+    } else if (_context.partition.mode == Mode::direct_kway &&
+               _context.partition.objective == Objective::soed) {
+      uncoarsenAndRefine<SoedObjective>(refiner, current_metrics);
+    } else {
+      uncoarsenAndRefine<CutObjective>(refiner, current_metrics);
     }
 
     // This currently cannot be guaranteed for RB-partitioning and k != 2^x, since it might be
@@ -160,6 +131,13 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
         // _context.stats.set(StatTag::LocalSearch, "finalKm1", current_metrics.km1);
         improvement_found = current_metrics.km1 < initial_objective;
         break;
+      case Objective::soed:
+        if (_context.partition.mode == Mode::recursive_bisection) {
+          // see km1
+          current_metrics.km1 = metrics::km1(_hg);
+        }
+        improvement_found = current_metrics.cut + current_metrics.km1 < initial_objective;
+        break;
       default:
         LOG << "Unknown Objective";
         exit(-1);
@@ -168,6 +146,78 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     return improvement_found;
   }
 
+  template <class ObjectivePolicy>
+  void uncoarsenAndRefine(IRefiner& refiner, Metrics& current_metrics) {
+    if (_context.local_search.fast_projection) {
+      projectPartitionToInputHypergraph();
+      CoarsenerBase::initializeRefiner(refiner);
+      refineInputHypergraph<ObjectivePolicy>(refiner, current_metrics);
+    } else {
+      CoarsenerBase::initializeRefiner(refiner);
+    }
+    const HypernodeID batch_size = std::max(_context.local_search.uncontraction_batch_size,
+                                            static_cast<HypernodeID>(1));
+    std::vector<HypernodeID> refinement_nodes(2, 0);
+    UncontractionGainChanges changes;
+    changes.representative.push_back(0);
+    changes.contraction_partner.push_back(0);
+
+    ProgressBar uncontraction_progress_bar(
+      _hg.initialNumNodes(), ObjectivePolicy::value(current_metrics),
+      _context.partition.verbose_output && _context.type == ContextType::main);
+    uncontraction_progress_bar += _hg.currentNumNodes();
+    if (unlikely(Tracer::instance().isEnabled())) {
+      CoarsenerBase::startUncoarseningTrace();
+    }
+    while (!_history.empty()) {
+      if (time_limit::isSoftTimeLimitExceeded(_context, _history.size())) {
+        /*
+         * There are two ways to implement this time limit.
+         * 1) skip refinement but perform full uncontractions, including updates. This can be slow
+         * 2) only perform the partition projection of the uncontractions. This leaves the dynamic hypergraph in a "broken" state, i.e.
+         * hyperedges are still as in the contracted hypergraph, whereas vertices are unpacked and activated.
+         *
+         * We implement 2) because all considered output measures are either already maintained (i.e. part weights and imbalance)
+         * or can be computed on the state of hyperedges in the contracted hypergraph.
+         * This means, this time limit should not be used to
+         */
+          while (!_history.empty()) {
+            _hg.restoreMemento(_history.back().contraction_memento);
+            _history.pop_back();
+          }
+        break;
+      }
+
+      const size_t history_size_before_batch = _history.size();
+      refinement_nodes.clear();
+      if (batch_size == 1) {
+        refinement_nodes.push_back(_history.back().contraction_memento.u);
+        refinement_nodes.push_back(_history.back().contraction_memento.v);
+        uncontract(changes);
+      } else {
+        uncontractBatch(refiner, batch_size, refinement_nodes, changes);
+      }
+
+      CoarsenerBase::template performLocalSearch<ObjectivePolicy>(refiner, refinement_nodes,
+                                                                 current_metrics, changes);
+      changes.representative[0] = 0;
+      changes.contraction_partner[0] = 0;
+
+      if (unlikely(Tracer::instance().isEnabled())) {
+        CoarsenerBase::traceUncoarseningLevel();
+      }
+
+      // Update Progress Bar
+      uncontraction_progress_bar += history_size_before_batch - _history.size();
+      uncontraction_progress_bar.setObjective(ObjectivePolicy::value(current_metrics));
+
+      if (_history.size() % _context.partition.soft_time_limit_check_frequency == 0) {
+        progress::report(_context, ProgressPhase::uncoarsening, _history.size(),
+                         _hg.currentNumNodes(), ObjectivePolicy::value(current_metrics));
+      }
+    }
+  }
+
   void uncontract(UncontractionGainChanges& changes) {
     DBG << "Uncontracting: (" << _history.back().contraction_memento.u << ","
         << _history.back().contraction_memento.v << ")";
@@ -178,8 +228,8 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
       _max_hn_weights.pop_back();
     }
 
-    if (_context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
-        _context.local_search.algorithm == RefinementAlgorithm::twoway_fm_hyperflow_cutter) {
+    ScopedPerfCounter perf_counter(PerfRegion::uncontraction);
+    if (usesTwoWayGainCache()) {
       _hg.uncontract(_history.back().contraction_memento, changes,
                      meta::Int2Type<static_cast<int>(RefinementAlgorithm::twoway_fm)>());
     } else {
@@ -188,6 +238,100 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     _history.pop_back();
   }
 
+  // Fast path for tight deadlines: all contractions are undone without calling the
+  // refiner in between. Thus, no gain cache has to be maintained and the refiner is
+  // initialized only once on the input hypergraph.
+  // The block IDs are projected through the contraction mementos, while the
+  // hypergraph itself is uncontracted without a partition. Pin counts, connectivity
+  // sets and cut hyperedges are then computed only once on the input hypergraph.
+  void projectPartitionToInputHypergraph() {
+    ScopedPerfCounter perf_counter(PerfRegion::uncontraction);
+    std::vector<PartitionID> partition(_hg.initialNumNodes(), Hypergraph::kInvalidPartition);
+    for (const HypernodeID& hn : _hg.nodes()) {
+      partition[hn] = _hg.partID(hn);
+    }
+    _hg.resetPartitioning();
+    while (!_history.empty()) {
+      restoreParallelHyperedges();
+      restoreSingleNodeHyperedges();
+      if (_hg.currentNumNodes() > _max_hn_weights.back().num_nodes) {
+        _max_hn_weights.pop_back();
+      }
+      const Hypergraph::ContractionMemento& memento = _history.back().contraction_memento;
+      partition[memento.v] = partition[memento.u];
+      _hg.uncontractUnpartitioned(memento);
+      _history.pop_back();
+    }
+    ASSERT(_hg.currentNumNodes() == _hg.initialNumNodes(), V(_hg.currentNumNodes()));
+    for (const HypernodeID& hn : _hg.nodes()) {
+      _hg.setNodePart(hn, partition[hn]);
+    }
+    _hg.initializeNumCutHyperedges();
+  }
+
+  // Runs local search on the input hypergraph, seeded with all border hypernodes.
+  template <class ObjectivePolicy>
+  void refineInputHypergraph(IRefiner& refiner, Metrics& current_metrics) {
+    if (time_limit::isSoftTimeLimitExceeded(_context)) {
+      return;
+    }
+    std::vector<HypernodeID> refinement_nodes;
+    for (const HypernodeID& hn : _hg.nodes()) {
+      if (_hg.isBorderNode(hn)) {
+        refinement_nodes.push_back(hn);
+      }
+    }
+    // The 2-way FM refiner expects at least one uncontracted pair of hypernodes.
+    if (refinement_nodes.size() < 2) {
+      return;
+    }
+    UncontractionGainChanges no_changes;
+    no_changes.representative.push_back(0);
+    no_changes.contraction_partner.push_back(0);
+    CoarsenerBase::template performLocalSearch<ObjectivePolicy>(refiner, refinement_nodes,
+                                                               current_metrics, no_changes);
+  }
+
+  // Uncontracts up to batch_size mementos and collects all uncontracted hypernodes
+  // as seeds for a single local search. Since an uncontraction only changes the gains
+  // of its own two hypernodes, the k-way gain caches are recomputed for all seeds when
+  // they are activated. The delta-based 2-way gain cache in contrast has to be updated
+  // after each uncontraction, before the next one changes the gains again.
+  // A batch ends early at multiples of soft_time_limit_check_frequency, such that the
+  // time limit is still polled at the same points as without batching.
+  void uncontractBatch(IRefiner& refiner, const HypernodeID batch_size,
+                       std::vector<HypernodeID>& refinement_nodes,
+                       UncontractionGainChanges& changes) {
+    std::vector<HypernodeID> uncontracted_pair(2, 0);
+    const std::vector<Move> no_moves;
+    for (HypernodeID i = 0; i < batch_size && !_history.empty() &&
+         (i == 0 || _history.size() % _context.partition.soft_time_limit_check_frequency != 0);
+         ++i) {
+      uncontracted_pair[0] = _history.back().contraction_memento.u;
+      uncontracted_pair[1] = _history.back().contraction_memento.v;
+      refinement_nodes.push_back(uncontracted_pair[0]);
+      refinement_nodes.push_back(uncontracted_pair[1]);
+
+      uncontract(changes);
+
+      if (usesTwoWayGainCache()) {
+        refiner.performMovesAndUpdateCache(no_moves, uncontracted_pair, changes);
+      }
+      changes.representative[0] = 0;
+      changes.contraction_partner[0] = 0;
+    }
+    // Representatives can be part of several uncontractions of the same batch,
+    // but each hypernode must only be activated once.
+    std::sort(refinement_nodes.begin(), refinement_nodes.end());
+    refinement_nodes.erase(std::unique(refinement_nodes.begin(), refinement_nodes.end()),
+                           refinement_nodes.end());
+  }
+
+  bool usesTwoWayGainCache() const {
+    return _context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
+           _context.local_search.algorithm == RefinementAlgorithm::twoway_fm_hyperflow_cutter;
+  }
+
   template <typename Rater>
   void rateAllHypernodes(Rater& rater,
                          std::vector<HypernodeID>& target) {
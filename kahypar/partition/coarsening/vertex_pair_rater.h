@@ -37,6 +37,7 @@
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/utils/perf_counters.h"
 
 namespace kahypar {
 template <class ScorePolicy = HeavyEdgeScore,
@@ -93,6 +94,7 @@ class VertexPairRater {
   ~VertexPairRater() = default;
 
   VertexPairRating rate(const HypernodeID u) {
+    ScopedPerfCounter perf_counter(PerfRegion::rating);
     DBG << "Calculating rating for HN" << u;
     const HypernodeWeight weight_u = _hg.nodeWeight(u);
     for (const HyperedgeID& he : _hg.incidentEdges(u)) {
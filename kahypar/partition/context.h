@@ -21,10 +21,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <sstream>
 #include <string>
@@ -36,6 +39,27 @@
 #include "kahypar/utils/stats.h"
 
 namespace kahypar {
+class AnytimeSolutionReporter;
+
+// Called with the partition, the objective and the imbalance of each
+// improving solution found during partitioning (see anytime_solution_reporter.h).
+using ImprovedSolutionCallback = std::function<void (const std::vector<PartitionID>&,
+                                                     const HyperedgeWeight, const double)>;
+
+struct PartitioningProgress {
+  ProgressPhase phase;
+  // Number of contractions that are currently not undone, i.e., the current
+  // level of the n-level hierarchy.
+  size_t level;
+  HypernodeID num_nodes;
+  // Objective of the current partition (0 during coarsening).
+  HyperedgeWeight objective;
+};
+
+// Called periodically during partitioning (see kahypar/utils/progress.h).
+// Returning true requests cancellation of the partitioning call.
+using ProgressCallback = std::function<bool (const PartitioningProgress&)>;
+
 struct MinHashSparsifierParameters {
   uint32_t max_hyperedge_size = std::numeric_limits<uint32_t>::max();
   uint32_t max_cluster_size = std::numeric_limits<uint32_t>::max();
@@ -58,6 +82,7 @@ struct PreprocessingParameters {
   bool enable_min_hash_sparsifier = false;
   bool enable_community_detection = false;
   bool enable_deduplication = false;
+  NodeOrdering node_ordering = NodeOrdering::input;
   MinHashSparsifierParameters min_hash_sparsifier = MinHashSparsifierParameters();
   CommunityDetection community_detection = CommunityDetection();
 };
@@ -105,6 +130,7 @@ inline std::ostream& operator<< (std::ostream& str, const PreprocessingParameter
       << params.enable_min_hash_sparsifier << std::endl;
   str << "  enable community detection:         " << std::boolalpha
       << params.enable_community_detection << std::endl;
+  str << "  node ordering:                      " << params.node_ordering << std::endl;
   if (params.enable_min_hash_sparsifier) {
     str << "-------------------------------------------------------------------------------"
         << std::endl;
@@ -209,6 +235,11 @@ struct LocalSearchParameters {
   HyperFlowCutter hyperflowcutter { };
   RefinementAlgorithm algorithm = RefinementAlgorithm::UNDEFINED;
   int iterations_per_level = std::numeric_limits<int>::max();
+  // Number of uncontractions that are followed by one local search seeded
+  // with all uncontracted hypernodes (n-level uncoarsening only).
+  HypernodeID uncontraction_batch_size = 1;
+  // Undo all contractions at once and only refine the input hypergraph.
+  bool fast_projection = false;
 };
 
 
@@ -216,6 +247,9 @@ inline std::ostream& operator<< (std::ostream& str, const LocalSearchParameters&
   str << "Local Search Parameters:" << std::endl;
   str << "  Algorithm:                          " << params.algorithm << std::endl;
   str << "  iterations per level:               " << params.iterations_per_level << std::endl;
+  str << "  uncontraction batch size:           " << params.uncontraction_batch_size << std::endl;
+  str << "  fast projection:                    " << std::boolalpha << params.fast_projection
+      << std::endl;
   if (params.algorithm == RefinementAlgorithm::twoway_fm ||
       params.algorithm == RefinementAlgorithm::kway_fm ||
       params.algorithm == RefinementAlgorithm::kway_fm_km1 ||
@@ -316,6 +350,11 @@ struct PartitioningParameters {
   double soft_time_limit_factor = 0.99;
   HighResClockTimepoint start_time;
   mutable bool time_limit_triggered = false;
+  // Phases that were cut short because the time limit was exceeded. Allocated for
+  // each partitioning call and shared by all sub-contexts of the call, since they
+  // check the time limit as well.
+  std::shared_ptr<std::array<bool, static_cast<size_t>(TimeLimitPhase::COUNT)> > time_limited_phases =
+    std::make_shared<std::array<bool, static_cast<size_t>(TimeLimitPhase::COUNT)> >();
 
   mutable uint32_t current_v_cycle = 0;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
@@ -331,11 +370,23 @@ struct PartitioningParameters {
   bool use_individual_part_weights = false;
   bool vcycle_refinement_for_input_partition = false;
   bool write_partition_file = false;
+  bool perf_counters = false;
+  bool anytime_partition_output = false;
+
+  ImprovedSolutionCallback improved_solution_callback { };
+  AnytimeSolutionReporter* anytime_reporter = nullptr;
+
+  ProgressCallback progress_callback { };
+  // Shared by all sub-contexts of a partitioning call (see kahypar/utils/progress.h).
+  std::shared_ptr<std::atomic<bool> > cancellation_requested =
+    std::make_shared<std::atomic<bool> >(false);
+  bool in_partitioning_call = false;
 
   std::string graph_filename { };
   std::string graph_partition_filename { };
   std::string fixed_vertex_filename { };
   std::string input_partition_filename { };
+  std::string trace_filename { };
 };
 
 inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters& params) {
@@ -348,6 +399,9 @@ inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters
   if (!params.input_partition_filename.empty()) {
     str << "  Input Partition File:                  " << params.input_partition_filename << std::endl;
   }
+  if (!params.trace_filename.empty()) {
+    str << "  Trace File:                         " << params.trace_filename << std::endl;
+  }
   str << "  Mode:                               " << params.mode << std::endl;
   str << "  Objective:                          " << params.objective << std::endl;
   str << "  k:                                  " << params.k << std::endl;
@@ -379,6 +433,8 @@ inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters
   return str;
 }
 struct EvolutionaryParameters {
+  static constexpr int max_dynamic_population_size = 50;
+
   size_t population_size;
   float mutation_chance;
   float edge_frequency_chance;
@@ -397,8 +453,12 @@ struct EvolutionaryParameters {
   const std::vector<PartitionID>* parent2 = nullptr;
   mutable std::vector<size_t> edge_frequency;
   mutable std::vector<ClusterID> communities;
+  mutable size_t population_memory = 0;  // bytes held by the individuals of the population
   bool unlimited_coarsening_contraction;
   bool random_vcycles;
+  std::string checkpoint_filename { };  // empty disables checkpointing
+  double checkpoint_interval = 60.0;  // seconds between two checkpoints
+  bool resume = false;
 };
 
 inline std::ostream& operator<< (std::ostream& str, const EvolutionaryParameters& params) {
@@ -441,7 +501,12 @@ class Context {
     evolutionary(other.evolutionary),
     type(other.type),
     stats(*this, &other.stats.topLevel()),
-    partition_evolutionary(other.partition_evolutionary) { }
+    partition_evolutionary(other.partition_evolutionary) {
+    if (!other.partition.in_partitioning_call) {
+      // Copies made outside of a partitioning call are cancelled independently.
+      partition.cancellation_requested = std::make_shared<std::atomic<bool> >(false);
+    }
+  }
 
   Context& operator= (const Context&) = delete;
 
@@ -523,6 +588,7 @@ inline std::ostream& operator<< (std::ostream& str, const Context& context) {
 static inline void checkRecursiveBisectionMode(RefinementAlgorithm& algo) {
   if (algo == RefinementAlgorithm::kway_fm ||
       algo == RefinementAlgorithm::kway_fm_km1 ||
+      algo == RefinementAlgorithm::kway_fm_soed ||
       algo == RefinementAlgorithm::kway_hyperflow_cutter ||
       algo == RefinementAlgorithm::kway_fm_hyperflow_cutter ||
       algo == RefinementAlgorithm::kway_fm_hyperflow_cutter_km1) {
@@ -535,7 +601,8 @@ static inline void checkRecursiveBisectionMode(RefinementAlgorithm& algo) {
     std::cin >> answer;
     answer = std::toupper(answer);
     if (answer == 'Y') {
-      if (algo == RefinementAlgorithm::kway_fm || algo == RefinementAlgorithm::kway_fm_km1) {
+      if (algo == RefinementAlgorithm::kway_fm || algo == RefinementAlgorithm::kway_fm_km1 ||
+          algo == RefinementAlgorithm::kway_fm_soed) {
         algo = RefinementAlgorithm::twoway_fm;
       } else if (algo == RefinementAlgorithm::kway_hyperflow_cutter) {
         algo = RefinementAlgorithm::twoway_hyperflow_cutter;
@@ -564,6 +631,8 @@ static inline void checkDirectKwayMode(RefinementAlgorithm& algo, Objective& obj
         algo = RefinementAlgorithm::kway_fm;
       } else if (algo == RefinementAlgorithm::twoway_fm && objective == Objective::km1) {
         algo = RefinementAlgorithm::kway_fm_km1;
+      } else if (algo == RefinementAlgorithm::twoway_fm && objective == Objective::soed) {
+        algo = RefinementAlgorithm::kway_fm_soed;
       } else if (algo == RefinementAlgorithm::twoway_hyperflow_cutter) {
         algo = RefinementAlgorithm::kway_hyperflow_cutter;
       } else if (algo == RefinementAlgorithm::twoway_fm_hyperflow_cutter && objective == Objective::km1) {
@@ -632,6 +701,21 @@ static inline void sanityCheck(const Hypergraph& hypergraph, Context& context) {
       // should never happen, because initial partitioning is either done via RB or directly
       break;
   }
+  if (context.evolutionary.resume &&
+      (!context.partition_evolutionary || context.evolutionary.checkpoint_filename.empty())) {
+    LOG << "Resuming from a checkpoint requires --partition-evolutionary=true and --checkpoint";
+    std::exit(0);
+  }
+
+  // Evolutionary operators contract and reset the input hypergraph in place,
+  // which requires an n-level coarsener.
+  if (context.partition_evolutionary &&
+      context.coarsening.algorithm == CoarseningAlgorithm::ml_hierarchy) {
+    LOG << "Coarsening algorithm" << context.coarsening.algorithm
+        << "is not supported with --partition-evolutionary=true.";
+    std::exit(0);
+  }
+
   if (context.partition.use_individual_part_weights && context.partition.max_part_weights.empty()) {
     LOG << "Individual block weights not specified. Please use --blockweights to specify the weight of each block";
     std::exit(0);
@@ -688,6 +772,14 @@ static inline void sanityCheck(const Hypergraph& hypergraph, Context& context) {
     }
   }
 
+  if (context.partition.mode == Mode::direct_kway &&
+      context.partition.objective != Objective::soed &&
+      context.local_search.algorithm == RefinementAlgorithm::kway_fm_soed) {
+    LOG << "\nRefinement algorithm" << context.local_search.algorithm
+        << "currently only works for soed optimization.";
+    std::exit(0);
+  }
+
   if (context.partition.mode == Mode::direct_kway &&
       context.partition.objective == Objective::cut) {
     if (context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1 ||
@@ -706,6 +798,25 @@ static inline void sanityCheck(const Hypergraph& hypergraph, Context& context) {
       LOG << "Please use the corresponding connectivity (km1) algorithm.";
       std::exit(0);
     }
+  } else if (context.partition.mode == Mode::direct_kway &&
+             context.partition.objective == Objective::soed) {
+    // The flow networks of the HyperFlowCutter refiners model the cut or km1
+    // metric of a block pair, but not soed.
+    if (context.local_search.algorithm == RefinementAlgorithm::kway_hyperflow_cutter ||
+        context.local_search.algorithm == RefinementAlgorithm::kway_fm_hyperflow_cutter ||
+        context.local_search.algorithm == RefinementAlgorithm::kway_fm_hyperflow_cutter_km1) {
+      LOG << "\nFlow-based refinement algorithm" << context.local_search.algorithm
+          << "does not support soed optimization.";
+      LOG << "Please use kway_fm_soed.";
+      std::exit(0);
+    }
+    if (context.local_search.algorithm == RefinementAlgorithm::kway_fm ||
+        context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1) {
+      LOG << "\nRefinement algorithm" << context.local_search.algorithm
+          << "does not optimize soed.";
+      LOG << "Please use kway_fm_soed.";
+      std::exit(0);
+    }
   }
 
   if (context.partition.global_search_iterations != 0 &&
@@ -82,6 +82,7 @@ enum class CoarseningAlgorithm : uint8_t {
   heavy_full,
   heavy_lazy,
   ml_style,
+  ml_hierarchy,
   do_nothing,
   UNDEFINED
 };
@@ -90,6 +91,7 @@ enum class RefinementAlgorithm : uint8_t {
   twoway_fm,
   kway_fm,
   kway_fm_km1,
+  kway_fm_soed,
   twoway_fm_hyperflow_cutter,
   twoway_hyperflow_cutter,
   kway_hyperflow_cutter,
@@ -131,6 +133,13 @@ enum class LouvainEdgeWeight : uint8_t {
   UNDEFINED
 };
 
+enum class NodeOrdering : uint8_t {
+  input,
+  bfs,
+  degree,
+  UNDEFINED
+};
+
 enum class RefinementStoppingRule : uint8_t {
   simple,
   adaptive_opt,
@@ -140,6 +149,7 @@ enum class RefinementStoppingRule : uint8_t {
 enum class Objective : uint8_t {
   cut,
   km1,
+  soed,
   UNDEFINED
 };
 enum class EvoReplaceStrategy : uint8_t {
@@ -179,6 +189,21 @@ enum class FlowHypergraphSizeConstraint : uint8_t {
   scaled_max_part_weight_fraction_minus_opposite_side
 };
 
+enum class TimeLimitPhase : uint8_t {
+  preprocessing,
+  coarsening,
+  initial_partitioning,
+  local_search,
+  flow_refinement,
+  COUNT
+};
+
+enum class ProgressPhase : uint8_t {
+  coarsening,
+  initial_partitioning,
+  uncoarsening
+};
+
 static std::ostream& operator<< (std::ostream& os, const EvoReplaceStrategy& replace) {
   switch (replace) {
     case EvoReplaceStrategy::worst: return os << "worst";
@@ -240,6 +265,29 @@ static std::ostream& operator<< (std::ostream& os, const Mode& mode) {
   return os << static_cast<uint8_t>(mode);
 }
 
+static std::ostream& operator<< (std::ostream& os, const TimeLimitPhase& phase) {
+  switch (phase) {
+    case TimeLimitPhase::preprocessing: return os << "preprocessing";
+    case TimeLimitPhase::coarsening: return os << "coarsening";
+    case TimeLimitPhase::initial_partitioning: return os << "initial_partitioning";
+    case TimeLimitPhase::local_search: return os << "local_search";
+    case TimeLimitPhase::flow_refinement: return os << "flow_refinement";
+    case TimeLimitPhase::COUNT: return os << "";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(phase);
+}
+
+static std::ostream& operator<< (std::ostream& os, const ProgressPhase& phase) {
+  switch (phase) {
+    case ProgressPhase::coarsening: return os << "coarsening";
+    case ProgressPhase::initial_partitioning: return os << "initial_partitioning";
+    case ProgressPhase::uncoarsening: return os << "uncoarsening";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(phase);
+}
+
 static std::ostream& operator<< (std::ostream& os, const ContextType& type) {
   if (type == ContextType::main) {
     return os << "main";
@@ -304,6 +352,7 @@ static std::ostream& operator<< (std::ostream& os, const Objective& objective) {
   switch (objective) {
     case Objective::cut: return os << "cut";
     case Objective::km1: return os << "km1";
+    case Objective::soed: return os << "soed";
     case Objective::UNDEFINED: return os << "UNDEFINED";
       // omit default case to trigger compiler warning for missing cases
   }
@@ -325,6 +374,7 @@ static std::ostream& operator<< (std::ostream& os, const CoarseningAlgorithm& al
     case CoarseningAlgorithm::heavy_full: return os << "heavy_full";
     case CoarseningAlgorithm::heavy_lazy: return os << "heavy_lazy";
     case CoarseningAlgorithm::ml_style: return os << "ml_style";
+    case CoarseningAlgorithm::ml_hierarchy: return os << "ml_hierarchy";
     case CoarseningAlgorithm::do_nothing: return os << "do_nothing";
     case CoarseningAlgorithm::UNDEFINED: return os << "UNDEFINED";
       // omit default case to trigger compiler warning for missing cases
@@ -337,6 +387,7 @@ static std::ostream& operator<< (std::ostream& os, const RefinementAlgorithm& al
     case RefinementAlgorithm::twoway_fm: return os << "twoway_fm";
     case RefinementAlgorithm::kway_fm: return os << "kway_fm";
     case RefinementAlgorithm::kway_fm_km1: return os << "kway_fm_km1";
+    case RefinementAlgorithm::kway_fm_soed: return os << "kway_fm_soed";
     case RefinementAlgorithm::twoway_hyperflow_cutter: return os << "twoway_hyperflow_cutter";
     case RefinementAlgorithm::twoway_fm_hyperflow_cutter: return os << "twoway_fm_hyperflow_cutter";
     case RefinementAlgorithm::kway_hyperflow_cutter: return os << "kway_hyperflow_cutter";
@@ -383,6 +434,17 @@ static std::ostream& operator<< (std::ostream& os, const LouvainEdgeWeight& weig
   return os << static_cast<uint8_t>(weight);
 }
 
+static std::ostream& operator<< (std::ostream& os, const NodeOrdering& ordering) {
+  switch (ordering) {
+    case NodeOrdering::input: return os << "input";
+    case NodeOrdering::bfs: return os << "bfs";
+    case NodeOrdering::degree: return os << "degree";
+    case NodeOrdering::UNDEFINED: return os << "UNDEFINED";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(ordering);
+}
+
 static std::ostream& operator<< (std::ostream& os, const RefinementStoppingRule& rule) {
   switch (rule) {
     case RefinementStoppingRule::simple: return os << "simple";
@@ -520,6 +582,8 @@ static CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type
     return CoarseningAlgorithm::heavy_lazy;
   } else if (type == "ml_style") {
     return CoarseningAlgorithm::ml_style;
+  } else if (type == "ml_hierarchy") {
+    return CoarseningAlgorithm::ml_hierarchy;
   } else if (type == "do_nothing") {
     return CoarseningAlgorithm::do_nothing;
   }
@@ -535,6 +599,8 @@ static RefinementAlgorithm refinementAlgorithmFromString(const std::string& type
     return RefinementAlgorithm::kway_fm;
   } else if (type == "kway_fm_km1") {
     return RefinementAlgorithm::kway_fm_km1;
+  } else if (type == "kway_fm_soed") {
+    return RefinementAlgorithm::kway_fm_soed;
   } else if (type == "twoway_hyperflow_cutter") {
     return RefinementAlgorithm::twoway_hyperflow_cutter;
   } else if (type == "kway_hyperflow_cutter") {
@@ -612,6 +678,19 @@ static LouvainEdgeWeight edgeWeightFromString(const std::string& type) {
   return LouvainEdgeWeight::uniform;
 }
 
+static NodeOrdering nodeOrderingFromString(const std::string& ordering) {
+  if (ordering == "input") {
+    return NodeOrdering::input;
+  } else if (ordering == "bfs") {
+    return NodeOrdering::bfs;
+  } else if (ordering == "degree") {
+    return NodeOrdering::degree;
+  }
+  LOG << "Illegal option:" << ordering;
+  exit(0);
+  return NodeOrdering::input;
+}
+
 static Mode modeFromString(const std::string& mode) {
   if (mode == "recursive") {
     return Mode::recursive_bisection;
@@ -23,6 +23,7 @@
 #include <limits>
 
 #include "kahypar/definitions.h"
+#include "kahypar/partition/anytime_solution_reporter.h"
 #include "kahypar/partition/coarsening/hypergraph_pruner.h"
 #include "kahypar/partition/coarsening/i_coarsener.h"
 #include "kahypar/partition/context.h"
@@ -30,6 +31,8 @@
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/multilevel.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/progress.h"
+#include "kahypar/utils/time_limit.h"
 
 namespace kahypar {
 namespace direct_kway {
@@ -51,7 +54,9 @@ static inline bool partitionVCycle(Hypergraph& hypergraph, ICoarsener& coarsener
                         std::chrono::duration<double>(end - start).count());
 
   if (context.partition.verbose_output && context.type == ContextType::main) {
-    io::printHypergraphInfo(hypergraph, "Coarsened Hypergraph");
+    io::printHypergraphInfo(coarsener.coarsestHypergraph() != nullptr ?
+                            *coarsener.coarsestHypergraph() : hypergraph,
+                            "Coarsened Hypergraph");
   }
 
   hypergraph.initializeNumCutHyperedges();
@@ -81,6 +86,7 @@ static inline void partition(Hypergraph& hypergraph, const Context& context) {
 
   if (!context.partition.vcycle_refinement_for_input_partition) {
     multilevel::partition(hypergraph, *coarsener, *refiner, context);
+    reportAnytimeSolution(hypergraph, context);
   }
 
 #ifdef KAHYPAR_USE_ASSERTIONS
@@ -89,6 +95,9 @@ static inline void partition(Hypergraph& hypergraph, const Context& context) {
 #endif
 
   for (uint32_t vcycle = 1; vcycle <= context.partition.global_search_iterations; ++vcycle) {
+    if (context.partition.time_limit_triggered || progress::isCancellationRequested(context)) {
+      break;
+    }
     context.partition.current_v_cycle = vcycle;
     const bool improved_quality = partitionVCycle(hypergraph, *coarsener, *refiner, context);
 
@@ -96,6 +105,7 @@ static inline void partition(Hypergraph& hypergraph, const Context& context) {
       LOG << "No improvement in V-cycle" << vcycle << ". Stopping global search.";
       break;
     }
+    reportAnytimeSolution(hypergraph, context);
 
     ASSERT(metrics::hyperedgeCut(hypergraph) <= initial_cut,
            metrics::hyperedgeCut(hypergraph) << ">" << initial_cut);
@@ -30,11 +30,13 @@
 #include "kahypar/datastructure/hypergraph.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/context_enum_classes.h"
+#include "kahypar/partition/evolutionary/checkpoint.h"
 #include "kahypar/partition/evolutionary/combine.h"
 #include "kahypar/partition/evolutionary/diversifier.h"
 #include "kahypar/partition/evolutionary/mutate.h"
 #include "kahypar/partition/evolutionary/population.h"
 #include "kahypar/partition/evolutionary/probability_tables.h"
+#include "kahypar/utils/progress.h"
 
 
 namespace kahypar {
@@ -45,17 +47,24 @@ class EvoPartitioner {
  public:
   explicit EvoPartitioner(const Context& context) :
     _timelimit(),
-    _population() {
+    _population(),
+    _checkpointer(context) {
     _timelimit = context.partition.time_limit;
   }
 
   inline void partition(Hypergraph& hg, Context& context) {
     context.partition_evolutionary = true;
 
+    if (context.evolutionary.resume) {
+      resumeFromCheckpoint(hg, context);
+    }
+
     generateInitialPopulation(hg, context);
 
-    while (Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
+    while (Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit &&
+           !progress::isCancellationRequested(context)) {
       ++context.evolutionary.iteration;
+      context.evolutionary.population_memory = _population.memoryConsumption();
 
 
       if (context.evolutionary.diversify_interval != -1 &&
@@ -79,6 +88,12 @@ class EvoPartitioner {
           LOG << "Error in evo_partitioner.h: Non-covered case in decision making";
           std::exit(EXIT_FAILURE);
       }
+      checkpointIfDue(hg, context);
+    }
+    if (_checkpointer.isEnabled()) {
+      _checkpointer.wait();
+      _checkpointer.write(hg, context, _population,
+                          Timer::instance().evolutionaryResult().total_evolutionary);
     }
     hg.reset();
     hg.setPartition(_population.individualAt(_population.best()).partition());
@@ -92,14 +107,37 @@ class EvoPartitioner {
   FRIEND_TEST(TheEvoPartitioner, ProperlyGeneratesTheInitialPopulation);
   FRIEND_TEST(TheEvoPartitioner, RespectsLimitsOfTheInitialPopulation);
   FRIEND_TEST(TheEvoPartitioner, IsCorrectlyDecidingTheActions);
+  inline void resumeFromCheckpoint(Hypergraph& hg, Context& context) {
+    EvoCheckpoint checkpoint;
+    if (!EvoCheckpointer::read(context.evolutionary.checkpoint_filename, hg, context, checkpoint)) {
+      LOG << "Error: cannot resume evolutionary partitioning from checkpoint"
+          << context.evolutionary.checkpoint_filename;
+      std::exit(EXIT_FAILURE);
+    }
+    EvoCheckpointer::restore(hg, context, _population, checkpoint);
+    // Only the remaining time budget is used for the resumed run.
+    Timer::instance().add(context, Timepoint::evolutionary, checkpoint.elapsed_time);
+    LOGCC(!context.partition.quiet_mode, true)
+      << "Resuming evolutionary partitioning with" << _population.size() << "individuals after"
+      << checkpoint.elapsed_time << "s and" << context.evolutionary.iteration << "iterations";
+  }
+
+  inline void checkpointIfDue(const Hypergraph& hg, const Context& context) {
+    if (_checkpointer.isDue()) {
+      _checkpointer.write(hg, context, _population,
+                          Timer::instance().evolutionaryResult().total_evolutionary);
+    }
+  }
+
   inline void generateInitialPopulation(Hypergraph& hg, Context& context) {
     // INITIAL POPULATION
-    if (context.evolutionary.dynamic_population_size) {
+    if (context.evolutionary.dynamic_population_size && _population.size() == 0) {
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
       _population.generateIndividual(hg, context);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
       Timer::instance().add(context, Timepoint::evolutionary,
                             std::chrono::duration<double>(end - start).count());
+      context.evolutionary.population_memory = _population.memoryConsumption();
 
       ++context.evolutionary.iteration;
       io::serializer::serializeEvolutionary(context, hg);
@@ -108,7 +146,8 @@ class EvoPartitioner {
                                                / Timer::instance().evolutionaryResult().total_evolutionary);
       int minimal_size = std::max(dynamic_population_size, 3);
 
-      context.evolutionary.population_size = std::min(minimal_size, 50);
+      context.evolutionary.population_size =
+        std::min(minimal_size, EvolutionaryParameters::max_dynamic_population_size);
       DBG << context.evolutionary.population_size;
       DBG << _population;
     }
@@ -116,16 +155,19 @@ class EvoPartitioner {
     DBG << "EDGE-FREQUENCY-AMOUNT";
     DBG << context.evolutionary.edge_frequency_amount;
     while (_population.size() < context.evolutionary.population_size &&
-           Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
+           Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit &&
+           (_population.size() == 0 || !progress::isCancellationRequested(context))) {
       ++context.evolutionary.iteration;
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
       _population.generateIndividual(hg, context);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
       Timer::instance().add(context, Timepoint::evolutionary,
                             std::chrono::duration<double>(end - start).count());
+      context.evolutionary.population_memory = _population.memoryConsumption();
       io::serializer::serializeEvolutionary(context, hg);
       verbose(context, 0);
       DBG << _population;
+      checkpointIfDue(hg, context);
     }
   }
 
@@ -225,5 +267,6 @@ class EvoPartitioner {
 
   int _timelimit;
   Population _population;
+  EvoCheckpointer _checkpointer;
 };
 }  // namespace kahypar
@@ -0,0 +1,328 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/evolutionary/population.h"
+#include "kahypar/utils/randomize.h"
+
+namespace kahypar {
+// State of an evolutionary run that is needed to continue it after a restart.
+struct EvoCheckpoint {
+  double elapsed_time = 0.0;
+  int iteration = 0;
+  size_t population_size = 0;
+  size_t edge_frequency_amount = 0;
+  std::string rng_state { };
+  std::vector<ClusterID> communities { };
+  std::vector<HyperedgeWeight> fitness { };
+  std::vector<std::vector<PartitionID> > partitions { };
+};
+
+// Periodically writes the population and the state of the evolutionary algorithm
+// to a checkpoint file. The snapshot of the population is taken synchronously, while
+// the file itself is written by a background thread to not stall the evolution.
+// Checkpoint files are written to a temporary file first and then renamed, such that
+// a preemption during a write never destroys the last valid checkpoint.
+class EvoCheckpointer {
+ private:
+  static constexpr bool debug = false;
+  static constexpr uint64_t kMagic = 0x5043564f4550484bULL;  // "KHPEVOCP"
+  static constexpr uint32_t kVersion = 1;
+
+ public:
+  explicit EvoCheckpointer(const Context& context) :
+    _filename(context.evolutionary.checkpoint_filename),
+    _interval(context.evolutionary.checkpoint_interval),
+    _last_checkpoint(std::chrono::high_resolution_clock::now()),
+    _writer(),
+    _writing(false) { }
+
+  EvoCheckpointer(const EvoCheckpointer&) = delete;
+  EvoCheckpointer& operator= (const EvoCheckpointer&) = delete;
+
+  EvoCheckpointer(EvoCheckpointer&&) = delete;
+  EvoCheckpointer& operator= (EvoCheckpointer&&) = delete;
+
+  ~EvoCheckpointer() {
+    wait();
+  }
+
+  bool isEnabled() const {
+    return !_filename.empty();
+  }
+
+  bool isDue() const {
+    return isEnabled() && std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - _last_checkpoint).count() >= _interval;
+  }
+
+  // Returns false if the checkpoint was skipped, because the previous one
+  // is still being written.
+  bool write(const Hypergraph& hypergraph, const Context& context,
+             const Population& population, const double elapsed_time) {
+    ASSERT(isEnabled());
+    if (_writing.load(std::memory_order_acquire)) {
+      DBG << "Skipping checkpoint: previous checkpoint is still being written";
+      return false;
+    }
+    wait();
+    _last_checkpoint = std::chrono::high_resolution_clock::now();
+    _writing.store(true, std::memory_order_release);
+    _writer = std::thread([this, buffer = serialize(hypergraph, context, population, elapsed_time)]() {
+        writeAtomically(buffer, _filename);
+        _writing.store(false, std::memory_order_release);
+      });
+    return true;
+  }
+
+  void wait() {
+    if (_writer.joinable()) {
+      _writer.join();
+    }
+  }
+
+  static std::string serialize(const Hypergraph& hypergraph, const Context& context,
+                               const Population& population, const double elapsed_time) {
+    std::string buffer;
+    append(buffer, kMagic);
+    append(buffer, kVersion);
+    append(buffer, static_cast<uint64_t>(hypergraph.initialNumNodes()));
+    append(buffer, static_cast<int32_t>(context.partition.k));
+    append(buffer, static_cast<uint8_t>(context.partition.objective));
+    append(buffer, static_cast<int32_t>(context.partition.seed));
+    append(buffer, elapsed_time);
+    append(buffer, static_cast<int32_t>(context.evolutionary.iteration));
+    append(buffer, static_cast<uint64_t>(context.evolutionary.population_size));
+    append(buffer, static_cast<uint64_t>(context.evolutionary.edge_frequency_amount));
+
+    std::ostringstream rng_state;
+    rng_state << Randomize::instance().getGenerator();
+    appendString(buffer, rng_state.str());
+
+    append(buffer, static_cast<uint64_t>(context.evolutionary.communities.size()));
+    for (const ClusterID community : context.evolutionary.communities) {
+      append(buffer, static_cast<int32_t>(community));
+    }
+
+    // Individuals are stored in compact form: only the block IDs of the
+    // partition using the smallest integer type that can represent k blocks.
+    const uint8_t bytes_per_block = bytesPerBlock(context.partition.k);
+    append(buffer, static_cast<uint64_t>(population.size()));
+    append(buffer, bytes_per_block);
+    for (size_t i = 0; i < population.size(); ++i) {
+      const Individual& individual = population.individualAt(i);
+      append(buffer, static_cast<int32_t>(individual.fitness()));
+      for (const PartitionID part : individual.partition()) {
+        switch (bytes_per_block) {
+          case 1:
+            append(buffer, static_cast<uint8_t>(part));
+            break;
+          case 2:
+            append(buffer, static_cast<uint16_t>(part));
+            break;
+          default:
+            append(buffer, static_cast<int32_t>(part));
+        }
+      }
+    }
+    return buffer;
+  }
+
+  // Reads the checkpoint written for the given hypergraph and context.
+  // Returns false if the file is missing or does not belong to this run.
+  static bool read(const std::string& filename, const Hypergraph& hypergraph,
+                   const Context& context, EvoCheckpoint& checkpoint) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+      LOG << "Could not open checkpoint file" << filename;
+      return false;
+    }
+
+    if (extract<uint64_t>(file) != kMagic || extract<uint32_t>(file) != kVersion || !file) {
+      LOG << "File" << filename << "is not a valid KaHyPar checkpoint";
+      return false;
+    }
+
+    const uint64_t num_nodes = extract<uint64_t>(file);
+    const int32_t k = extract<int32_t>(file);
+    const uint8_t objective = extract<uint8_t>(file);
+    extract<int32_t>(file);  // seed, only stored for reference
+    if (num_nodes != hypergraph.initialNumNodes() || k != context.partition.k ||
+        objective != static_cast<uint8_t>(context.partition.objective)) {
+      LOG << "Checkpoint" << filename << "was written for a different hypergraph,"
+          << "number of blocks or objective";
+      return false;
+    }
+
+    checkpoint.elapsed_time = extract<double>(file);
+    checkpoint.iteration = extract<int32_t>(file);
+    checkpoint.population_size = extract<uint64_t>(file);
+    checkpoint.edge_frequency_amount = extract<uint64_t>(file);
+    checkpoint.rng_state = extractString(file);
+
+    // All sizes are checked before anything is allocated for them, since a
+    // corrupted checkpoint might contain arbitrary values.
+    const uint64_t num_communities = extract<uint64_t>(file);
+    if (!file || (num_communities != 0 && num_communities != num_nodes)) {
+      LOG << "Checkpoint" << filename << "contains an invalid community structure";
+      return false;
+    }
+    checkpoint.communities.resize(num_communities);
+    for (ClusterID& community : checkpoint.communities) {
+      community = extract<int32_t>(file);
+    }
+
+    const uint64_t num_individuals = extract<uint64_t>(file);
+    const uint8_t bytes_per_block = extract<uint8_t>(file);
+    if (!file || checkpoint.population_size > maxPopulationSize(context) ||
+        num_individuals > checkpoint.population_size ||
+        bytes_per_block != bytesPerBlock(context.partition.k)) {
+      LOG << "Checkpoint" << filename << "contains an invalid population";
+      return false;
+    }
+    checkpoint.fitness.resize(num_individuals);
+    checkpoint.partitions.assign(num_individuals, std::vector<PartitionID>(num_nodes));
+    for (uint64_t i = 0; i < num_individuals; ++i) {
+      checkpoint.fitness[i] = extract<int32_t>(file);
+      for (PartitionID& part : checkpoint.partitions[i]) {
+        switch (bytes_per_block) {
+          case 1:
+            part = extract<uint8_t>(file);
+            break;
+          case 2:
+            part = extract<uint16_t>(file);
+            break;
+          default:
+            part = extract<int32_t>(file);
+        }
+        if (part < 0 || part >= context.partition.k) {
+          LOG << "Checkpoint" << filename << "contains an invalid block ID" << part;
+          return false;
+        }
+      }
+    }
+
+    if (!file) {
+      LOG << "Checkpoint" << filename << "is truncated";
+      return false;
+    }
+    return true;
+  }
+
+  // Restores the population and the state of the evolutionary algorithm.
+  static void restore(Hypergraph& hypergraph, Context& context, Population& population,
+                      const EvoCheckpoint& checkpoint) {
+    context.evolutionary.iteration = checkpoint.iteration;
+    context.evolutionary.population_size = checkpoint.population_size;
+    context.evolutionary.edge_frequency_amount = checkpoint.edge_frequency_amount;
+    context.evolutionary.communities = checkpoint.communities;
+
+    for (size_t i = 0; i < checkpoint.partitions.size(); ++i) {
+      const Individual& individual = population.restoreIndividual(hypergraph, context,
+                                                                  checkpoint.partitions[i]);
+      ONLYDEBUG(individual);
+      ASSERT(individual.fitness() == checkpoint.fitness[i],
+             V(individual.fitness()) << V(checkpoint.fitness[i]));
+    }
+
+    std::istringstream rng_state(checkpoint.rng_state);
+    rng_state >> Randomize::instance().getGenerator();
+  }
+
+ private:
+  // With a dynamic population size, the population size of the context is
+  // only determined when the evolutionary algorithm starts.
+  static size_t maxPopulationSize(const Context& context) {
+    if (context.evolutionary.dynamic_population_size) {
+      return std::max<size_t>(context.evolutionary.population_size,
+                              EvolutionaryParameters::max_dynamic_population_size);
+    }
+    return context.evolutionary.population_size;
+  }
+
+  static uint8_t bytesPerBlock(const PartitionID k) {
+    if (k <= 256) {
+      return 1;
+    } else if (k <= 65536) {
+      return 2;
+    }
+    return 4;
+  }
+
+  template <typename T>
+  static void append(std::string& buffer, const T value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  static void appendString(std::string& buffer, const std::string& str) {
+    append(buffer, static_cast<uint64_t>(str.size()));
+    buffer.append(str);
+  }
+
+  template <typename T>
+  static T extract(std::ifstream& file) {
+    T value = T();
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+
+  static std::string extractString(std::ifstream& file) {
+    std::string str(extract<uint64_t>(file), '\0');
+    file.read(&str[0], str.size());
+    return str;
+  }
+
+  static void writeAtomically(const std::string& buffer, const std::string& filename) {
+    const std::string tmp_filename = filename + ".tmp";
+    {
+      std::ofstream out(tmp_filename, std::ios::binary | std::ios::trunc);
+      out.write(buffer.data(), buffer.size());
+      if (!out) {
+        LOG << "WARNING: could not write checkpoint file" << tmp_filename;
+        return;
+      }
+    }
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+      LOG << "WARNING: could not replace checkpoint file" << filename;
+    }
+  }
+
+  const std::string _filename;
+  const double _interval;
+  HighResClockTimepoint _last_checkpoint;
+  std::thread _writer;
+  std::atomic<bool> _writing;
+};
+}  // namespace kahypar
@@ -109,9 +109,26 @@ class Population {
     return _individuals.back();
   }
 
+  // Re-creates an individual from a partition, e.g. when resuming from a checkpoint.
+  inline const Individual & restoreIndividual(Hypergraph& hg, const Context& context,
+                                              const std::vector<PartitionID>& partition) {
+    hg.reset();
+    hg.setPartition(partition);
+    _individuals.emplace_back(Individual(hg, context));
+    return _individuals.back();
+  }
+
   inline size_t size() const {
     return _individuals.size();
   }
+
+  inline size_t memoryConsumption() const {
+    size_t memory = _individuals.capacity() * sizeof(Individual);
+    for (const Individual& individual : _individuals) {
+      memory += individual.memoryConsumption();
+    }
+    return memory;
+  }
   inline size_t randomIndividual() const {
     return Randomize::instance().getRandomInt(0, size() - 1);
   }
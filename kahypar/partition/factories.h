@@ -27,6 +27,7 @@
 #include "kahypar/partition/coarsening/i_coarsener.h"
 #include "kahypar/partition/coarsening/lazy_vertex_pair_coarsener.h"
 #include "kahypar/partition/coarsening/ml_coarsener.h"
+#include "kahypar/partition/coarsening/ml_hierarchy_coarsener.h"
 #include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
@@ -40,6 +41,7 @@
 #include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
 #include "kahypar/partition/refinement/kway_fm_km1_refiner.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+#include "kahypar/partition/refinement/refiner_factory.h"
 #include "kahypar/partition/bin_packing/i_bin_packer.h"
 
 namespace kahypar {
@@ -50,9 +52,6 @@ using CoarsenerFactory = meta::Factory<CoarseningAlgorithm,
 using InitialPartitioningFactory = meta::Factory<InitialPartitionerAlgorithm,
                                                  IInitialPartitioner* (*)(Hypergraph&, Context&)>;
 
-using RefinerFactory = meta::Factory<RefinementAlgorithm,
-                                     IRefiner* (*)(Hypergraph&, const Context&)>;
-
 using BinPackerFactory = meta::Factory<BinPackingAlgorithm, IBinPacker* (*)()>;
 
 using RatingPolicies = meta::Typelist<RatingScorePolicies, HeavyNodePenaltyPolicies,
@@ -63,6 +62,10 @@ using MLCoarseningDispatcher = meta::StaticMultiDispatchFactory<MLCoarsener,
                                                                 ICoarsener,
                                                                 RatingPolicies>;
 
+using MLHierarchyCoarseningDispatcher = meta::StaticMultiDispatchFactory<MLHierarchyCoarsener,
+                                                                         ICoarsener,
+                                                                         RatingPolicies>;
+
 using FullCoarseningDispatcher = meta::StaticMultiDispatchFactory<FullVertexPairCoarsener,
                                                                   ICoarsener,
                                                                   RatingPolicies>;
@@ -83,6 +86,10 @@ using KWayKMinusOneFactoryDispatcher = meta::StaticMultiDispatchFactory<KWayKMin
                                                                         IRefiner,
                                                                         meta::Typelist<StoppingPolicyClasses> >;
 
+using KWaySOEDFactoryDispatcher = meta::StaticMultiDispatchFactory<KWaySOEDRefiner,
+                                                                   IRefiner,
+                                                                   meta::Typelist<StoppingPolicyClasses> >;
+
 using TwoWayHyperFlowCutterFactoryDispatcher = meta::StaticMultiDispatchFactory<TwoWayHyperFlowCutterRefiner,
                                                                                 IRefiner,
                                                                                 meta::Typelist<FlowExecutionPolicyClasses> >;
@@ -23,12 +23,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <queue>
 #include <utility>
 #include <vector>
 
 #include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/datastructure/sparse_map.h"
 #include "kahypar/definitions.h"
 #include "kahypar/io/hypergraph_io.h"
 #include "kahypar/partition/context.h"
@@ -39,6 +42,8 @@ using NodeID = int32_t;
 using Flow = HyperedgeWeight;
 
 using AdjacencyMatrix = std::vector<std::vector<HyperedgeWeight> >;
+// Row i contains all R-vertices j with non-zero weight w as pairs (j, w) sorted by j.
+using SparseBipartiteGraph = std::vector<std::vector<std::pair<PartitionID, HyperedgeWeight> > >;
 using Matching = std::vector<std::pair<PartitionID, PartitionID> >;
 using VertexCover = std::vector<NodeID>;
 
@@ -351,10 +356,10 @@ class MinimumBipartiteVertexCover final : public MaximumBipartiteMatching {
   Matching _maximum_matching;
 };
 
-static inline AdjacencyMatrix setupWeightedBipartiteMatchingGraph(Hypergraph& input_hypergraph,
-                                                                  const Context& original_context) {
+static inline SparseBipartiteGraph setupSparseWeightedBipartiteMatchingGraph(Hypergraph& input_hypergraph,
+                                                                             const Context& original_context) {
   const PartitionID k = original_context.partition.k;
-  AdjacencyMatrix graph(k, std::vector<HyperedgeWeight>(k, 0));
+  SparseBipartiteGraph graph(k);
 
   std::vector<std::vector<HypernodeID> > fixed_vertices(k, std::vector<HypernodeID>());
   for (const HypernodeID& hn : input_hypergraph.fixedVertices()) {
@@ -377,8 +382,10 @@ static inline AdjacencyMatrix setupWeightedBipartiteMatchingGraph(Hypergraph& in
   }
 
   ds::FastResetFlagArray<> visited(input_hypergraph.initialNumEdges());
+  ds::SparseMap<PartitionID, HyperedgeWeight> weights(k);
   for (PartitionID i = 0; i < k; ++i) {
     visited.reset();
+    weights.clear();
     for (const HypernodeID& hn : fixed_vertices[i]) {
       for (const HyperedgeID& he : input_hypergraph.incidentEdges(hn)) {
         if (!visited[he]) {
@@ -398,7 +405,7 @@ static inline AdjacencyMatrix setupWeightedBipartiteMatchingGraph(Hypergraph& in
             //       solve a maximum weighted bipartite matching problem
             //       to optimize the km1 metric (proposed by kPaToH)
             for (PartitionID j : input_hypergraph.connectivitySet(he)) {
-              graph[i][j] += input_hypergraph.edgeWeight(he);
+              weights[j] += input_hypergraph.edgeWeight(he);
             }
           } else if (original_context.partition.objective == Objective::cut) {
             // The cut metric only increases if we would make a non-cut
@@ -411,7 +418,17 @@ static inline AdjacencyMatrix setupWeightedBipartiteMatchingGraph(Hypergraph& in
             // the cut metric.
             if (input_hypergraph.connectivity(he) == 1 && fixed_connectivity[he] == 1) {
               for (PartitionID j : input_hypergraph.connectivitySet(he)) {
-                graph[i][j] += input_hypergraph.edgeWeight(he);
+                weights[j] += input_hypergraph.edgeWeight(he);
+              }
+            }
+          } else if (original_context.partition.objective == Objective::soed) {
+            // Since soed = km1 + cut, the savings of both metrics add up.
+            for (PartitionID j : input_hypergraph.connectivitySet(he)) {
+              weights[j] += input_hypergraph.edgeWeight(he);
+            }
+            if (input_hypergraph.connectivity(he) == 1 && fixed_connectivity[he] == 1) {
+              for (PartitionID j : input_hypergraph.connectivitySet(he)) {
+                weights[j] += input_hypergraph.edgeWeight(he);
               }
             }
           }
@@ -421,17 +438,42 @@ static inline AdjacencyMatrix setupWeightedBipartiteMatchingGraph(Hypergraph& in
     }
     // Discard assignment of fixed vertices to a block which violates
     // balanced contraint
-    for (PartitionID j = 0; j < k; ++j) {
-      if (input_hypergraph.fixedVertexPartWeight(i) + input_hypergraph.partWeight(j) >
+    for (const auto& element : weights) {
+      const PartitionID j = element.key;
+      if (element.value != 0 &&
+          input_hypergraph.fixedVertexPartWeight(i) + input_hypergraph.partWeight(j) <=
           original_context.partition.max_part_weights[0]) {
-        graph[i][j] = 0;
+        graph[i].emplace_back(j, element.value);
       }
     }
+    std::sort(graph[i].begin(), graph[i].end());
   }
 
   return graph;
 }
 
+static inline AdjacencyMatrix setupWeightedBipartiteMatchingGraph(Hypergraph& input_hypergraph,
+                                                                  const Context& original_context) {
+  const PartitionID k = original_context.partition.k;
+  AdjacencyMatrix graph(k, std::vector<HyperedgeWeight>(k, 0));
+  const SparseBipartiteGraph sparse_graph =
+    setupSparseWeightedBipartiteMatchingGraph(input_hypergraph, original_context);
+  for (PartitionID i = 0; i < k; ++i) {
+    for (const auto& edge : sparse_graph[i]) {
+      graph[i][edge.first] = edge.second;
+    }
+  }
+  return graph;
+}
+
+// Returns the weight of edge (i,j) of the sparse bipartite graph.
+static inline HyperedgeWeight edgeWeight(const SparseBipartiteGraph& graph,
+                                         const PartitionID i, const PartitionID j) {
+  const auto edge = std::lower_bound(graph[i].begin(), graph[i].end(),
+                                     std::make_pair(j, std::numeric_limits<HyperedgeWeight>::min()));
+  return edge != graph[i].end() && edge->first == j ? edge->second : 0;
+}
+
 static inline void printAdjacencyMatrix(const AdjacencyMatrix& graph, bool weighted = false) {
   if (debug) {
     const PartitionID k = graph.size();
@@ -624,6 +666,145 @@ static inline Matching findMaximumWeightedBipartiteMatching(const AdjacencyMatri
   return matching;
 }
 
+/**
+ * Computes a maximum weighted perfect matching with the same weight as
+ * the dense variant above, but only considers edges with non-zero weight.
+ *
+ * Since all weights are non-negative, the weight of a maximum weighted
+ * perfect matching in the complete bipartite graph is equal to the weight
+ * of a maximum weighted matching in the sparse graph: the latter can be
+ * completed with edges of weight zero. To compute it, each L-vertex i gets
+ * a private dummy R-vertex k + i, which it can be matched to with weight
+ * zero. A minimum cost assignment of all L-vertices (cost = -weight) is then
+ * computed with the successive shortest path algorithm: For each L-vertex,
+ * Dijkstra's algorithm finds a shortest augmenting path w.r.t. the reduced
+ * costs c(i,j) - u[i] - v[j] >= 0 defined by the dual potentials u and v.
+ * Finally, L-vertices matched to their dummy vertex are assigned to the
+ * remaining R-vertices.
+ *
+ * Time complexity: O(k * |E| * log(k)), where |E| is the number of non-zero edges
+ *
+ * References:
+ * Jonker, Roy and Anton Volgenant.
+ * "A shortest augmenting path algorithm for dense and sparse linear assignment problems."
+ * Computing 38.4 (1987): 325-340.
+ */
+static inline Matching findMaximumWeightedBipartiteMatching(const SparseBipartiteGraph& graph) {
+  using Cost = int64_t;
+  static constexpr Cost kInfinity = std::numeric_limits<Cost>::max();
+  const PartitionID k = graph.size();
+  const NodeID num_right_vertices = 2 * k;
+
+  std::vector<Cost> u(k, 0);
+  std::vector<Cost> v(num_right_vertices, 0);
+  for (PartitionID i = 0; i < k; ++i) {
+    for (const auto& edge : graph[i]) {
+      u[i] = std::min(u[i], static_cast<Cost>(-edge.second));
+    }
+  }
+
+  std::vector<NodeID> matched_right(k, -1);
+  std::vector<PartitionID> matched_left(num_right_vertices, -1);
+  std::vector<Cost> distance(num_right_vertices, kInfinity);
+  std::vector<PartitionID> parent(num_right_vertices, -1);
+  std::vector<NodeID> reached;
+  std::vector<NodeID> settled;
+  ds::FastResetFlagArray<> is_settled(num_right_vertices);
+  using QueueElement = std::pair<Cost, NodeID>;
+  std::priority_queue<QueueElement, std::vector<QueueElement>, std::greater<QueueElement> > queue;
+
+  auto relax = [&](const NodeID j, const PartitionID i, const Cost distance_i, const Cost cost) {
+                 const Cost d = distance_i + cost - u[i] - v[j];
+                 if (!is_settled[j] && d < distance[j]) {
+                   if (distance[j] == kInfinity) {
+                     reached.push_back(j);
+                   }
+                   distance[j] = d;
+                   parent[j] = i;
+                   queue.emplace(d, j);
+                 }
+               };
+  auto relax_edges_of = [&](const PartitionID i, const Cost distance_i) {
+                          for (const auto& edge : graph[i]) {
+                            relax(edge.first, i, distance_i, -edge.second);
+                          }
+                          relax(k + i, i, distance_i, 0);
+                        };
+
+  for (PartitionID source = 0; source < k; ++source) {
+    relax_edges_of(source, 0);
+    NodeID sink = -1;
+    while (sink == -1) {
+      ASSERT(!queue.empty(), "Dummy vertex of L-vertex" << source << "is not reachable");
+      const NodeID j = queue.top().second;
+      queue.pop();
+      if (is_settled[j]) {
+        continue;
+      }
+      is_settled.set(j, true);
+      settled.push_back(j);
+      if (matched_left[j] == -1) {
+        sink = j;
+      } else {
+        relax_edges_of(matched_left[j], distance[j]);
+      }
+    }
+
+    // Update potentials such that all reduced costs stay non-negative
+    // and the edges of the augmenting path have a reduced cost of zero.
+    const Cost sink_distance = distance[sink];
+    u[source] += sink_distance;
+    for (const NodeID j : settled) {
+      if (j != sink) {
+        u[matched_left[j]] += sink_distance - distance[j];
+        v[j] -= sink_distance - distance[j];
+      }
+    }
+
+    // Augment
+    for (NodeID j = sink; ; ) {
+      const PartitionID i = parent[j];
+      const NodeID next = matched_right[i];
+      matched_left[j] = i;
+      matched_right[i] = j;
+      if (i == source) {
+        break;
+      }
+      j = next;
+    }
+
+    for (const NodeID j : reached) {
+      distance[j] = kInfinity;
+    }
+    reached.clear();
+    settled.clear();
+    is_settled.reset();
+    queue = decltype(queue)();
+  }
+
+  Matching matching;
+  std::vector<bool> is_matched(k, false);
+  for (PartitionID i = 0; i < k; ++i) {
+    if (matched_right[i] < k) {
+      matching.emplace_back(i, matched_right[i]);
+      is_matched[matched_right[i]] = true;
+    }
+  }
+  PartitionID unmatched = 0;
+  for (PartitionID i = 0; i < k; ++i) {
+    if (matched_right[i] >= k) {
+      while (is_matched[unmatched]) {
+        ++unmatched;
+      }
+      matching.emplace_back(i, unmatched);
+      is_matched[unmatched] = true;
+    }
+  }
+
+  ASSERT(matching.size() == static_cast<size_t>(k) && verify(matching, k), "Invalid matching");
+  return matching;
+}
+
 static inline void applyPermutation(const std::vector<PartitionID>& permutation,
                                     const std::vector<PartitionID>& original_partition,
                                     Hypergraph& hypergraph) {
@@ -665,8 +846,10 @@ static inline void partition(Hypergraph& input_hypergraph,
   // Aykanat, Cevdet, B. Barla Cambazoglu, and Bora Uçar.
   // "Multi-level direct k-way hypergraph partitioning with multiple constraints and fixed vertices."
   // Journal of Parallel and Distributed Computing 68.5 (2008): 609-625.
-  AdjacencyMatrix graph = setupWeightedBipartiteMatchingGraph(input_hypergraph, original_context);
-  printAdjacencyMatrix(graph, true);
+  // Only block pairs with non-zero weight are considered, which makes the assignment
+  // scale to large k (the number of such pairs is bounded by the number of pins).
+  const SparseBipartiteGraph graph =
+    setupSparseWeightedBipartiteMatchingGraph(input_hypergraph, original_context);
 
   Matching maximum_weighted_matching = findMaximumWeightedBipartiteMatching(graph);
   ASSERT(maximum_weighted_matching.size() == static_cast<size_t>(original_context.partition.k),
@@ -685,8 +868,8 @@ static inline void partition(Hypergraph& input_hypergraph,
     partition_permutation[from] = to;
     if (debug || original_context.initial_partitioning.verbose_output) {
       LOG << "Block" << from << "assigned to fixed vertices with id"
-          << to << "with weight" << graph[to][from];
-      matching_weight += graph[to][from];
+          << to << "with weight" << edgeWeight(graph, to, from);
+      matching_weight += edgeWeight(graph, to, from);
     }
   }
   if (debug || original_context.initial_partitioning.verbose_output) {
@@ -724,6 +907,11 @@ static inline void partition(Hypergraph& input_hypergraph,
       } else if (original_context.partition.objective == Objective::km1) {
         lower_bound += (min_connectivity[he] - 1) * input_hypergraph.edgeWeight(he);
         upper_bound += (max_connectivity[he] - 1) * input_hypergraph.edgeWeight(he);
+      } else if (original_context.partition.objective == Objective::soed) {
+        lower_bound += (min_connectivity[he] > 1 ? min_connectivity[he] : 0) *
+                       input_hypergraph.edgeWeight(he);
+        upper_bound += (max_connectivity[he] > 1 ? max_connectivity[he] : 0) *
+                       input_hypergraph.edgeWeight(he);
       }
     }
     LOG << "Lower Bound (" << original_context.partition.objective << ") :" << lower_bound;
@@ -770,9 +958,7 @@ static inline void partition(Hypergraph& input_hypergraph,
       applyPermutation(permutations, original_partition, input_hypergraph);
 
       DBG1 << original_context.partition.objective << "="
-           << (original_context.partition.objective == Objective::cut ?
-          metrics::hyperedgeCut(input_hypergraph) :
-          metrics::km1(input_hypergraph))
+           << metrics::objective(input_hypergraph, original_context.partition.objective)
            << V(metrics::imbalance(input_hypergraph, original_context));
     } while (std::next_permutation(permutations.begin(), permutations.end()));
 
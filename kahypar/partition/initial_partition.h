@@ -28,6 +28,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/factories.h"
 #include "kahypar/partition/initial_partitioning/i_initial_partitioner.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 namespace partition {
@@ -163,11 +164,14 @@ static inline void partition(Hypergraph& hg,
       context.initial_partitioning.mode == Mode::direct_kway) {
     // If the direct k-way flat initial partitioner is used we call the
     // corresponding initial partitioing algorithm, otherwise...
+    ScopedTrace trace("initial partitioner", "initial partitioning");
     std::unique_ptr<IInitialPartitioner> partitioner(
       InitialPartitioningFactory::getInstance().createObject(
         context.initial_partitioning.algo,
         init_hg, init_context));
     partitioner->partition();
+    trace.arg("algorithm", context.initial_partitioning.algo)
+    .arg("k", init_context.initial_partitioning.k);
   } else {
     // ... we call the partitioner again with the new configuration.
     partition::partition(init_hg, init_context);
@@ -36,6 +36,7 @@
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/time_limit.h"
 
 namespace kahypar {
 template <typename Derived = Mandatory>
@@ -112,11 +113,14 @@ class InitialPartitionerBase {
     double best_imbalance = std::numeric_limits<double>::max();
     std::vector<PartitionID> best_partition(_hg.initialNumNodes(), 0);
     for (uint32_t i = 0; i < _context.initial_partitioning.nruns; ++i) {
+      // If the time limit is exceeded, we only perform a single run.
+      if (i > 0 && time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::initial_partitioning)) {
+        break;
+      }
       // hg.resetPartitioning() is called in initial_partition
       static_cast<Derived*>(this)->initialPartition();
 
-      const HyperedgeWeight current_quality = obj == Objective::cut ?
-                                              metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
+      const HyperedgeWeight current_quality = metrics::objective(_hg, obj);
       const double current_imbalance = metrics::imbalance(_hg, _context);
       DBG << V(obj) << V(current_quality) << V(current_imbalance);
 
@@ -172,6 +176,12 @@ class InitialPartitionerBase {
                          _hg, _context));
             LOG << "kway_fm_km1.";
             break;
+          case Objective::soed:
+            refiner = (RefinerFactory::getInstance().createObject(
+                         RefinementAlgorithm::kway_fm_soed,
+                         _hg, _context));
+            LOG << "kway_fm_soed.";
+            break;
           case Objective::UNDEFINED:
             refiner = (RefinerFactory::getInstance().createObject(
                          RefinementAlgorithm::do_nothing,
@@ -30,6 +30,8 @@
 #include "kahypar/partition/initial_partitioning/initial_partitioner_base.h"
 #include "kahypar/partition/partitioner.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/time_limit.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 class PoolInitialPartitioner : public IInitialPartitioner,
@@ -56,9 +58,12 @@ class PoolInitialPartitioner : public IInitialPartitioner,
       if (objective == Objective::cut) {
         LOG << desc << "=" << "[ Cut=" << quality << "- Imbalance=" << imbalance << "- Algorithm="
             << algo << "]";
-      } else {
+      } else if (objective == Objective::km1) {
         LOG << desc << "=" << "[ Km1=" << quality << "- Imbalance=" << imbalance << "- Algorithm="
             << algo << "]";
+      } else {
+        LOG << desc << "=" << "[ SOED=" << quality << "- Imbalance=" << imbalance << "- Algorithm="
+            << algo << "]";
       }
     }
 
@@ -126,6 +131,11 @@ class PoolInitialPartitioner : public IInitialPartitioner,
       if (!((_context.initial_partitioning.pool_type >> (n - i)) & 1)) {
         continue;
       }
+      // If the time limit is exceeded, we keep the best partition found so far.
+      if (best_cut.quality != kInvalidCut &&
+          time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::initial_partitioning)) {
+        break;
+      }
       InitialPartitionerAlgorithm algo = _partitioner_pool[i];
       if (algo == InitialPartitionerAlgorithm::greedy_round_maxpin ||
           algo == InitialPartitionerAlgorithm::greedy_global_maxpin ||
@@ -133,12 +143,14 @@ class PoolInitialPartitioner : public IInitialPartitioner,
         DBG << "skipping maxpin";
         continue;
       }
+      ScopedTrace trace("initial partitioner", "initial partitioning");
       std::unique_ptr<IInitialPartitioner> partitioner(
         InitialPartitioningFactory::getInstance().createObject(algo, _hg, _context));
       partitioner->partition();
-      HyperedgeWeight current_quality = obj == Objective::cut ?
-                                        metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
+      HyperedgeWeight current_quality = metrics::objective(_hg, obj);
       double current_imbalance = metrics::imbalance(_hg, _context);
+      trace.arg("algorithm", algo).arg("quality", current_quality)
+      .arg("imbalance", current_imbalance).stop();
       DBG << algo << V(obj) << V(current_quality) << V(current_imbalance);
 
       const bool equal_metric = current_quality == best_cut.quality;
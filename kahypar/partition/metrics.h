@@ -34,30 +34,12 @@ struct Metrics {
   HyperedgeWeight km1;
   double imbalance;
 
-  void updateMetric(const HyperedgeWeight value, const Mode mode, const Objective objective) {
-    if (mode == Mode::direct_kway) {
-      switch (objective) {
-        case Objective::cut:
-          cut = value;
-          break;
-        case Objective::km1:
-          km1 = value;
-          break;
-        default:
-          LOG << "Unknown Objective";
-          exit(-1);
-      }
-    } else if (mode == Mode::recursive_bisection) {
-      // in recursive bisection, km1 is also optimized via the cut net metric
-      cut = value;
-    }
-  }
-
   HyperedgeWeight getMetric(const Mode mode, const Objective objective) {
     if (mode == Mode::direct_kway) {
       switch (objective) {
         case Objective::cut: return cut;
         case Objective::km1: return km1;
+        case Objective::soed: return cut + km1;
         default:
           LOG << "Unknown Objective";
           exit(-1);
@@ -119,6 +101,7 @@ static inline HyperedgeWeight objective(const Hypergraph& hg, const Objective& o
   switch (objective) {
     case Objective::cut: return hyperedgeCut(hg);
     case Objective::km1: return km1(hg);
+    case Objective::soed: return soed(hg);
     default:
       LOG << "Unknown Objective";
       exit(-1);
@@ -249,6 +232,8 @@ static inline HyperedgeWeight correctMetric(const Hypergraph& hypergraph, const
       return km1(hypergraph);
     case Objective::cut:
       return hyperedgeCut(hypergraph);
+    case Objective::soed:
+      return soed(hypergraph);
     default:
       LOG << "The specified Objective is not listed in the Metrics";
       std::exit(0);
@@ -281,4 +266,46 @@ static inline void connectivityStats(const Hypergraph& hypergraph,
   }
 }
 }  // namespace metrics
+
+// Compile-time access to the metric that the refiners optimize, such that the
+// uncoarsening loop does not branch on the objective for each uncontraction.
+class CutObjective final {
+ public:
+  static constexpr Objective objective = Objective::cut;
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static inline HyperedgeWeight value(const Metrics& metrics) {
+    return metrics.cut;
+  }
+
+  static inline HyperedgeWeight compute(const Hypergraph& hypergraph) {
+    return metrics::hyperedgeCut(hypergraph);
+  }
+};
+
+class Km1Objective final {
+ public:
+  static constexpr Objective objective = Objective::km1;
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static inline HyperedgeWeight value(const Metrics& metrics) {
+    return metrics.km1;
+  }
+
+  static inline HyperedgeWeight compute(const Hypergraph& hypergraph) {
+    return metrics::km1(hypergraph);
+  }
+};
+
+// soed = km1 + cut, the refiner therefore keeps both metrics up to date.
+class SoedObjective final {
+ public:
+  static constexpr Objective objective = Objective::soed;
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static inline HyperedgeWeight value(const Metrics& metrics) {
+    return metrics.cut + metrics.km1;
+  }
+
+  static inline HyperedgeWeight compute(const Hypergraph& hypergraph) {
+    return metrics::soed(hypergraph);
+  }
+};
 }  // namespace kahypar
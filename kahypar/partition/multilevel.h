@@ -30,7 +30,11 @@
 #include "kahypar/partition/initial_partition.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/memory.h"
+#include "kahypar/utils/perf_counters.h"
+#include "kahypar/utils/progress.h"
 #include "kahypar/utils/timer.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 namespace multilevel {
@@ -44,14 +48,34 @@ static inline void partition(Hypergraph& hypergraph,
                              const Context& context) {
   io::printCoarseningBanner(context);
 
+  ScopedTrace coarsening_trace("coarsening", "phase");
+  coarsening_trace.arg("context", context.type)
+  .arg("rb_lower_k", context.partition.rb_lower_k)
+  .arg("rb_upper_k", context.partition.rb_upper_k)
+  .arg("nodes", hypergraph.currentNumNodes());
+  ScopedPerfCounter coarsening_counter(PerfRegion::coarsening, context.type == ContextType::main);
   HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   coarsener.coarsen(context.coarsening.contraction_limit);
   HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  coarsening_counter.stop();
+  Hypergraph& coarsest = coarsener.coarsestHypergraph() != nullptr ?
+                         *coarsener.coarsestHypergraph() : hypergraph;
+  coarsening_trace.arg("coarse_nodes", coarsest.currentNumNodes()).stop();
   Timer::instance().add(context, Timepoint::coarsening,
                         std::chrono::duration<double>(end - start).count());
 
+  memory::recordRSS(context, StatTag::Coarsening);
+  if (context.type == ContextType::main) {
+    context.stats.set(StatTag::Coarsening, "hypergraphIncidenceBytes",
+                      hypergraph.incidenceStructureMemoryConsumption());
+    context.stats.set(StatTag::Coarsening, "hypergraphPartitionBytes",
+                      hypergraph.partitionMemoryConsumption());
+    context.stats.set(StatTag::Coarsening, "coarseningHistoryBytes",
+                      coarsener.memoryConsumption());
+  }
+
   if (!context.partition.quiet_mode && context.partition.verbose_output && context.type == ContextType::main) {
-    io::printHypergraphInfo(hypergraph, "Coarsened Hypergraph");
+    io::printHypergraphInfo(coarsest, "Coarsened Hypergraph");
   }
 
   if (!context.partition_evolutionary || context.evolutionary.action.requires().initial_partitioning) {
@@ -60,21 +84,34 @@ static inline void partition(Hypergraph& hypergraph,
     }
     io::printInitialPartitioningBanner(context);
 
+    ScopedTrace initial_partitioning_trace("initial partitioning", "phase");
+    initial_partitioning_trace.arg("context", context.type)
+    .arg("k", context.partition.k)
+    .arg("nodes", coarsest.currentNumNodes());
+    ScopedPerfCounter initial_partitioning_counter(PerfRegion::initial_partitioning,
+                                                   context.type == ContextType::main);
     start = std::chrono::high_resolution_clock::now();
-    initial::partition(hypergraph, context);
+    initial::partition(coarsest, context);
     end = std::chrono::high_resolution_clock::now();
+    initial_partitioning_counter.stop();
+    initial_partitioning_trace.stop();
     Timer::instance().add(context, Timepoint::initial_partitioning,
                           std::chrono::duration<double>(end - start).count());
+    memory::recordRSS(context, StatTag::InitialPartitioning);
 
-    hypergraph.initializeNumCutHyperedges();
+    coarsest.initializeNumCutHyperedges();
+    if (context.partition.progress_callback) {
+      progress::report(context, ProgressPhase::initial_partitioning,
+                       hypergraph.initialNumNodes() - coarsest.currentNumNodes(),
+                       coarsest.currentNumNodes(), metrics::correctMetric(coarsest, context));
+    }
     if (!context.partition.quiet_mode && context.partition.verbose_output && context.type == ContextType::main) {
       LOG << "Initial Partitioning Result:";
       LOG << "Initial" << context.partition.objective << "      ="
-          << (context.partition.objective == Objective::cut ? metrics::hyperedgeCut(hypergraph) :
-          metrics::km1(hypergraph));
-      LOG << "Initial imbalance =" << metrics::imbalance(hypergraph, context);
+          << metrics::objective(coarsest, context.partition.objective);
+      LOG << "Initial imbalance =" << metrics::imbalance(coarsest, context);
       LOG << "Initial part sizes and weights:";
-      io::printPartSizesAndWeights(hypergraph);
+      io::printPartSizesAndWeights(coarsest);
       LLOG << "Target weights:";
       if (context.partition.mode == Mode::direct_kway) {
         LLOG << "w(*) =" << context.partition.max_part_weights[0] << "\n";
@@ -118,13 +155,25 @@ static inline void partition(Hypergraph& hypergraph,
     io::printLocalSearchBanner(context);
   }
 
+  ScopedTrace uncoarsening_trace("uncoarsening", "phase");
+  uncoarsening_trace.arg("context", context.type)
+  .arg("rb_lower_k", context.partition.rb_lower_k)
+  .arg("rb_upper_k", context.partition.rb_upper_k);
+  ScopedPerfCounter local_search_counter(PerfRegion::local_search, context.type == ContextType::main);
   start = std::chrono::high_resolution_clock::now();
   coarsener.uncoarsen(refiner);
   end = std::chrono::high_resolution_clock::now();
+  local_search_counter.stop();
+  uncoarsening_trace.stop();
 
   Timer::instance().add(context, Timepoint::local_search,
                         std::chrono::duration<double>(end - start).count());
 
+  memory::recordRSS(context, StatTag::LocalSearch);
+  if (context.type == ContextType::main) {
+    context.stats.set(StatTag::LocalSearch, "gainCacheBytes", refiner.memoryConsumption());
+  }
+
   io::printLocalSearchResults(context, hypergraph);
 }
 
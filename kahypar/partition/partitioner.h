@@ -29,6 +29,7 @@
 #include "kahypar/definitions.h"
 #include "kahypar/io/hypergraph_io.h"
 #include "kahypar/io/partitioning_output.h"
+#include "kahypar/partition/anytime_solution_reporter.h"
 #include "kahypar/partition/coarsening/hypergraph_pruner.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/direct_kway.h"
@@ -37,8 +38,10 @@
 #include "kahypar/partition/preprocessing/hypergraph_deduplicator.h"
 #include "kahypar/partition/preprocessing/louvain.h"
 #include "kahypar/partition/preprocessing/min_hash_sparsifier.h"
+#include "kahypar/partition/preprocessing/node_reordering.h"
 #include "kahypar/partition/preprocessing/single_node_hyperedge_remover.h"
 #include "kahypar/partition/recursive_bisection.h"
+#include "kahypar/utils/memory.h"
 
 namespace kahypar {
 // Workaround for bug in gtest
@@ -90,7 +93,8 @@ class Partitioner {
   Partitioner() :
     _single_node_he_remover(),
     _pin_sparsifier(),
-    _deduplicator() { }
+    _deduplicator(),
+    _node_reordering() { }
 
   Partitioner(const Partitioner&) = delete;
   Partitioner& operator= (const Partitioner&) = delete;
@@ -128,6 +132,10 @@ class Partitioner {
 
   inline void sanitize(Hypergraph& hypergraph, const Context& context);
 
+  static inline bool isNodeReorderingActive(const Context& context);
+
+  inline void partitionSanitizedHypergraph(Hypergraph& hypergraph, Context& context);
+
   inline void preprocess(Hypergraph& hypergraph, const Context& context);
   inline void preprocess(Hypergraph& hypergraph, Hypergraph& sparse_hypergraph,
                          const Context& context);
@@ -139,6 +147,7 @@ class Partitioner {
   SingleNodeHyperedgeRemover _single_node_he_remover;
   MinHashSparsifier _pin_sparsifier;
   HypergraphDeduplicator _deduplicator;
+  NodeReordering _node_reordering;
 };
 
 inline void Partitioner::configurePreprocessing(const Hypergraph& hypergraph,
@@ -262,25 +271,17 @@ inline void Partitioner::postprocess(Hypergraph& hypergraph, Hypergraph& sparse_
   const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
   Timer::instance().add(context, Timepoint::post_sparsifier_restore,
                         std::chrono::duration<double>(end - start).count());
-  postprocess(hypergraph);
 }
 
-inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
-  configurePreprocessing(hypergraph, context);
-
-  setupContext(hypergraph, context);
-  io::printInputInformation(context, hypergraph);
-
-  io::printTopLevelPreprocessingBanner(context);
-  if (context.preprocessing.enable_deduplication) {
-    // deduplication needs to be called first, because the code
-    // currently assumes that all HEs and HNs in the hypergraph
-    // exist (i.e., are enabled).
-    _deduplicator.deduplicate(hypergraph, context);
-  }
-
-  sanitize(hypergraph, context);
+inline bool Partitioner::isNodeReorderingActive(const Context& context) {
+  // The partitions of the evolutionary algorithm and the input partition of
+  // V-cycle refinement refer to the IDs of the input hypergraph.
+  return context.preprocessing.node_ordering != NodeOrdering::input &&
+         !context.partition_evolutionary &&
+         !context.partition.vcycle_refinement_for_input_partition;
+}
 
+inline void Partitioner::partitionSanitizedHypergraph(Hypergraph& hypergraph, Context& context) {
   if (context.preprocessing.min_hash_sparsifier.is_active) {
     ALWAYS_ASSERT(!context.partition_evolutionary ||
                   context.evolutionary.action.decision() == EvoDecision::normal,
@@ -288,6 +289,7 @@ inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
                   "and while filling the initial population of KaHyParE.");
     Hypergraph sparseHypergraph;
     preprocess(hypergraph, sparseHypergraph, context);
+    memory::recordRSS(context, StatTag::Preprocessing);
     ASSERT(sparseHypergraph.numFixedVertices() == hypergraph.numFixedVertices());
     partition::partition(sparseHypergraph, context);
     hypergraph.reset();
@@ -300,9 +302,46 @@ inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
     context.evolutionary.communities.clear();
   } else {
     preprocess(hypergraph, context);
+    memory::recordRSS(context, StatTag::Preprocessing);
     partition::partition(hypergraph, context);
-    postprocess(hypergraph);
   }
+}
+
+inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
+  configurePreprocessing(hypergraph, context);
+
+  setupContext(hypergraph, context);
+  io::printInputInformation(context, hypergraph);
+
+  io::printTopLevelPreprocessingBanner(context);
+  if (context.preprocessing.enable_deduplication) {
+    // deduplication needs to be called first, because the code
+    // currently assumes that all HEs and HNs in the hypergraph
+    // exist (i.e., are enabled).
+    _deduplicator.deduplicate(hypergraph, context);
+  }
+
+  sanitize(hypergraph, context);
+
+  if (isNodeReorderingActive(context)) {
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    Hypergraph reordered_hypergraph =
+      _node_reordering.buildReorderedHypergraph(hypergraph, context);
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    Timer::instance().add(context, Timepoint::pre_node_reordering,
+                          std::chrono::duration<double>(end - start).count());
+
+    partitionSanitizedHypergraph(reordered_hypergraph, context);
+
+    start = std::chrono::high_resolution_clock::now();
+    _node_reordering.applyPartition(reordered_hypergraph, hypergraph);
+    end = std::chrono::high_resolution_clock::now();
+    Timer::instance().add(context, Timepoint::post_node_reordering_restore,
+                          std::chrono::duration<double>(end - start).count());
+  } else {
+    partitionSanitizedHypergraph(hypergraph, context);
+  }
+  postprocess(hypergraph);
 
   _deduplicator.restoreRedundancy(hypergraph);
 
@@ -316,5 +355,7 @@ inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
       }
       return true;
     } (), "Fixed Vertices are assigned incorrectly!");
+
+  reportAnytimeSolution(hypergraph, context);
 }
 }  // namespace kahypar
@@ -33,6 +33,7 @@
 #include "kahypar/partition/preprocessing/modularity.h"
 #include "kahypar/utils/randomize.h"
 #include "kahypar/utils/stats.h"
+#include "kahypar/utils/time_limit.h"
 #include "kahypar/utils/timer.h"
 
 static constexpr bool debug = false;
@@ -123,7 +124,8 @@ class Louvain {
       }
 
       DBG << "";
-    } while (improvement && iteration < max_passes);
+    } while (improvement && iteration < max_passes &&
+             !time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::preprocessing));
 
     ASSERT((mapping_stack.size() + 1) == _graph_hierarchy.size());
     while (!mapping_stack.empty()) {
@@ -238,7 +240,8 @@ class Louvain {
 
       DBG << "Iteration #" << iterations << ": Moving" << node_moves << "nodes to new communities.";
     } while (node_moves > 0 &&
-             iterations < _context.preprocessing.community_detection.max_pass_iterations);
+             iterations < _context.preprocessing.community_detection.max_pass_iterations &&
+             !time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::preprocessing));
 
 
     return quality.quality();
@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+// Renumbers hypernodes and hyperedges such that hypernodes that share hyperedges
+// get similar IDs. The IDs of the input file usually do not reflect the structure
+// of the hypergraph, which causes cache misses whenever the pins of a hyperedge
+// or the incident hyperedges of a hypernode are accessed.
+//
+// The reordered hypergraph only contains the enabled hypernodes and hyperedges of
+// the input hypergraph. Hyperedges are ordered by the smallest new ID of their pins
+// and the pins of each hyperedge are sorted by their new IDs.
+class NodeReordering {
+ private:
+  static constexpr HypernodeID kInvalidID = std::numeric_limits<HypernodeID>::max();
+
+ public:
+  NodeReordering() :
+    _hn_to_reordered_hn() { }
+
+  NodeReordering(const NodeReordering&) = delete;
+  NodeReordering& operator= (const NodeReordering&) = delete;
+
+  NodeReordering(NodeReordering&&) = delete;
+  NodeReordering& operator= (NodeReordering&&) = delete;
+
+  ~NodeReordering() = default;
+
+  Hypergraph buildReorderedHypergraph(const Hypergraph& hypergraph, const Context& context) {
+    ASSERT(context.preprocessing.node_ordering != NodeOrdering::input);
+    const std::vector<HypernodeID> order =
+      context.preprocessing.node_ordering == NodeOrdering::bfs ?
+      bfsOrder(hypergraph) : degreeOrder(hypergraph);
+
+    _hn_to_reordered_hn.assign(hypergraph.initialNumNodes(), kInvalidID);
+    std::vector<HypernodeWeight> node_weights;
+    node_weights.reserve(order.size());
+    for (const HypernodeID& hn : order) {
+      _hn_to_reordered_hn[hn] = node_weights.size();
+      node_weights.push_back(hypergraph.nodeWeight(hn));
+    }
+
+    // Each hyperedge is identified by the smallest new ID of its pins
+    std::vector<std::pair<HypernodeID, HyperedgeID> > edges;
+    edges.reserve(hypergraph.currentNumEdges());
+    for (const HyperedgeID& he : hypergraph.edges()) {
+      HypernodeID min_pin = kInvalidID;
+      for (const HypernodeID& pin : hypergraph.pins(he)) {
+        min_pin = std::min(min_pin, _hn_to_reordered_hn[pin]);
+      }
+      edges.emplace_back(min_pin, he);
+    }
+    std::sort(edges.begin(), edges.end());
+
+    std::vector<size_t> index_vector;
+    index_vector.reserve(edges.size() + 1);
+    std::vector<HypernodeID> edge_vector;
+    edge_vector.reserve(hypergraph.currentNumPins());
+    std::vector<HyperedgeWeight> edge_weights;
+    edge_weights.reserve(edges.size());
+    for (const auto& edge : edges) {
+      const HyperedgeID he = edge.second;
+      index_vector.push_back(edge_vector.size());
+      for (const HypernodeID& pin : hypergraph.pins(he)) {
+        edge_vector.push_back(_hn_to_reordered_hn[pin]);
+      }
+      std::sort(edge_vector.begin() + index_vector.back(), edge_vector.end());
+      edge_weights.push_back(hypergraph.edgeWeight(he));
+    }
+    index_vector.push_back(edge_vector.size());
+
+    const bool has_edge_weights = hypergraph.type() == Hypergraph::Type::EdgeWeights ||
+                                  hypergraph.type() == Hypergraph::Type::EdgeAndNodeWeights;
+    const bool has_node_weights = hypergraph.type() == Hypergraph::Type::NodeWeights ||
+                                  hypergraph.type() == Hypergraph::Type::EdgeAndNodeWeights;
+    Hypergraph reordered_hypergraph(node_weights.size(), edges.size(), index_vector, edge_vector,
+                                    context.partition.k,
+                                    has_edge_weights ? &edge_weights : nullptr,
+                                    has_node_weights ? &node_weights : nullptr);
+
+    for (const HypernodeID& hn : hypergraph.fixedVertices()) {
+      reordered_hypergraph.setFixedVertex(_hn_to_reordered_hn[hn],
+                                          hypergraph.fixedVertexPartID(hn));
+    }
+    ASSERT(reordered_hypergraph.numFixedVertices() == hypergraph.numFixedVertices());
+    ASSERT(reordered_hypergraph.totalWeight() == hypergraph.totalWeight());
+
+    return reordered_hypergraph;
+  }
+
+  void applyPartition(const Hypergraph& reordered_hypergraph, Hypergraph& hypergraph) const {
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, reordered_hypergraph.partID(_hn_to_reordered_hn[hn]));
+    }
+  }
+
+  const std::vector<HypernodeID> & hnToReorderedHnMapping() const {
+    return _hn_to_reordered_hn;
+  }
+
+ private:
+  // Cuthill-McKee-like breadth-first search. Each connected component is traversed
+  // starting at one of its hypernodes of minimum degree. Hyperedges are expanded
+  // in the order in which they are reached.
+  static std::vector<HypernodeID> bfsOrder(const Hypergraph& hypergraph) {
+    std::vector<HypernodeID> start_nodes = degreeOrder(hypergraph);
+    std::reverse(start_nodes.begin(), start_nodes.end());
+
+    std::vector<bool> visited_hn(hypergraph.initialNumNodes(), false);
+    std::vector<bool> visited_he(hypergraph.initialNumEdges(), false);
+    std::vector<HypernodeID> order;
+    order.reserve(hypergraph.currentNumNodes());
+    for (const HypernodeID& start : start_nodes) {
+      if (visited_hn[start]) {
+        continue;
+      }
+      visited_hn[start] = true;
+      // order is used as BFS queue
+      size_t next = order.size();
+      order.push_back(start);
+      while (next < order.size()) {
+        const HypernodeID hn = order[next++];
+        for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+          if (visited_he[he]) {
+            continue;
+          }
+          visited_he[he] = true;
+          for (const HypernodeID& pin : hypergraph.pins(he)) {
+            if (!visited_hn[pin]) {
+              visited_hn[pin] = true;
+              order.push_back(pin);
+            }
+          }
+        }
+      }
+    }
+    ASSERT(order.size() == hypergraph.currentNumNodes());
+    return order;
+  }
+
+  // Hypernodes of high degree are accessed most frequently. Placing them next to
+  // each other keeps the frequently accessed part of the hypergraph compact.
+  static std::vector<HypernodeID> degreeOrder(const Hypergraph& hypergraph) {
+    std::vector<HypernodeID> order;
+    order.reserve(hypergraph.currentNumNodes());
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      order.push_back(hn);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&hypergraph](const HypernodeID u, const HypernodeID v) {
+          return hypergraph.nodeDegree(u) > hypergraph.nodeDegree(v);
+        });
+    return order;
+  }
+
+  std::vector<HypernodeID> _hn_to_reordered_hn;
+};
+}  // namespace kahypar
@@ -63,14 +63,22 @@ class TwoWayFMFlowRefiner final : public IRefiner,
   }
 
  private:
-  void performMovesAndUpdateCacheImpl(const std::vector<Move>&,
-                                      std::vector<HypernodeID>&,
-                                      const UncontractionGainChanges&) override final { }
+  // Batched uncoarsening applies the gain changes of each uncontraction to the gain
+  // cache of the FM refiner before the combined local search is started.
+  void performMovesAndUpdateCacheImpl(const std::vector<Move>& moves,
+                                      std::vector<HypernodeID>& refinement_nodes,
+                                      const UncontractionGainChanges& changes) override final {
+    _fm_refiner->performMovesAndUpdateCache(moves, refinement_nodes, changes);
+  }
 
   std::vector<Move> rollbackImpl() override final {
     return std::vector<Move>();
   }
 
+  size_t memoryConsumptionImpl() const override final {
+    return _fm_refiner->memoryConsumption() + _flow_refiner->memoryConsumption();
+  }
+
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     _fm_refiner->initialize(max_gain);
     _flow_refiner->initialize(max_gain);
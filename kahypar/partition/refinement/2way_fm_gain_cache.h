@@ -146,6 +146,10 @@ class TwoWayFMGainCache {
     }
   }
 
+  size_t memoryConsumption() const {
+    return _size * sizeof(CacheElement) + _used_delta_entries.capacity() * sizeof(size_t);
+  }
+
  private:
   const size_t _size;
   std::unique_ptr<CacheElement[]> _cache;
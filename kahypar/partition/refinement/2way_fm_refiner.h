@@ -44,6 +44,7 @@
 #include "kahypar/partition/refinement/move.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
 #include "kahypar/utils/float_compare.h"
+#include "kahypar/utils/perf_counters.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -138,6 +139,10 @@ class TwoWayFMRefiner final : public IRefiner,
   FRIEND_TEST(ATwoWayFMRefinerDeathTest, ConsidersSingleNodeHEsDuringInitialGainComputation);
   FRIEND_TEST(ATwoWayFMRefiner, KnowsIfAHyperedgeIsFullyActive);
 
+  size_t memoryConsumptionImpl() const override final {
+    return _gain_cache.memoryConsumption();
+  }
+
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     if (!_is_initialized) {
 #ifdef USE_BUCKET_QUEUE
@@ -232,10 +237,10 @@ class TwoWayFMRefiner final : public IRefiner,
     HyperedgeWeight current_cut = best_metrics.cut;
     double current_imbalance = best_metrics.imbalance;
 
-    int min_cut_index = -1;
     int touched_hns_since_last_improvement = 0;
     _stopping_policy.resetStatistics();
 
+    ScopedPerfCounter perf_counter(PerfRegion::fm_moves);
     const double beta = log(_hg.currentNumNodes());
     while (!_pq.empty() &&
            (!_stopping_policy.searchShouldStop(touched_hns_since_last_improvement,
@@ -306,19 +311,20 @@ class TwoWayFMRefiner final : public IRefiner,
         best_metrics.km1 = current_cut;
         best_metrics.imbalance = current_imbalance;
         _stopping_policy.resetStatistics();
-        min_cut_index = _performed_moves.size() - 1;
         touched_hns_since_last_improvement = 0;
+        Base::commitPerformedMoves();
         _gain_cache.resetDelta();
       }
     }
 
-    DBG << "KWayFM performed" << _performed_moves.size()
-        << "local search movements ( min_cut_index=" << min_cut_index << "): stopped because of "
+    perf_counter.stop();
+    DBG << "2WayFM stopped with" << _performed_moves.size()
+        << "local search movements since the last improvement because of "
         << (_stopping_policy.searchShouldStop(touched_hns_since_last_improvement, _context, beta,
                                           best_metrics.cut, current_cut)
         == true ? "policy" : "empty queue");
 
-    rollback(_performed_moves.size() - 1, min_cut_index);
+    rollback();
     _gain_cache.rollbackDelta();
 
     HEAVY_REFINEMENT_ASSERT(best_metrics.cut == metrics::hyperedgeCut(_hg));
@@ -639,14 +645,13 @@ class TwoWayFMRefiner final : public IRefiner,
     _gain_cache.updateCacheAndDelta(pin, gain_delta);
   }
 
-  void rollback(int last_index, const int min_cut_index) {
-    DBG << "min_cut_index=" << min_cut_index;
-    DBG << "last_index=" << last_index;
-    while (last_index != min_cut_index) {
-      HypernodeID hn = _performed_moves[last_index];
-      _hg.changeNodePart(hn, _hg.partID(hn), (_hg.partID(hn) ^ 1));
-      --last_index;
+  // Only rolls back the moves since the last improvement, see FMRefinerBase::commitPerformedMoves.
+  void rollback() {
+    DBG << "rolling back" << _performed_moves.size() << "moves";
+    for (auto rit = _performed_moves.crbegin(); rit != _performed_moves.crend(); ++rit) {
+      _hg.changeNodePart(*rit, _hg.partID(*rit), (_hg.partID(*rit) ^ 1));
     }
+    _performed_moves.clear();
   }
 
   Gain computeGain(const HypernodeID hn) const {
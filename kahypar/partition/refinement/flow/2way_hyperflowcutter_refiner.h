@@ -30,9 +30,11 @@
 #include "kahypar/partition/refinement/flow/quotient_graph_block_scheduler.h"
 #include "kahypar/partition/refinement/flow/whfc_flow_hypergraph_extraction.h"
 #include "kahypar/partition/refinement/move.h"
+#include "kahypar/utils/perf_counters.h"
 #include "kahypar/utils/time_limit.h"
 #include "kahypar/partition/refinement/i_refiner.h"
 #include "kahypar/utils/timer.h"
+#include "kahypar/utils/trace.h"
 
 
 #pragma GCC diagnostic push
@@ -62,6 +64,10 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
  private:
   static constexpr bool enable_heavy_assert = false;
   static constexpr bool debug = false;
+  // Per-node footprint of a flow network: node weight and excess flow in
+  // WHFC, distance from the cut and local-to-global ID during extraction.
+  static constexpr size_t kFlowNetworkBytesPerNode =
+    sizeof(whfc::NodeWeight) + sizeof(whfc::Flow) + sizeof(whfc::HopDistance) + sizeof(HypernodeID);
 
  public:
   TwoWayHyperFlowCutterRefiner(Hypergraph& hypergraph, const Context& context) :
@@ -70,6 +76,7 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
     hfc(extractor.flow_hg_builder, context.partition.seed),
     _quotient_graph(nullptr),
     _ignore_flow_execution_policy(false),
+    _max_flow_network_nodes(0),
     b0(0),
     b1(1) {
     hfc.find_most_balanced = context.local_search.hyperflowcutter.most_balanced_cut;
@@ -105,6 +112,9 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
     if (!_flow_execution_policy.executeFlow(_hg) && !_ignore_flow_execution_policy) {
       return false;
     }
+    if (time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::flow_refinement)) {
+      return false;
+    }
 
     HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
 
@@ -151,6 +161,13 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
       auto STF = extractor.run(_hg, _context, cut_hes, b0, b1, hfc.cs.borderNodes.distance);
       hfc.timer.stop("Extract Flow Snapshot");
 
+      if (_context.type == ContextType::main &&
+          extractor.flow_hg_builder.numNodes() > _max_flow_network_nodes) {
+        _max_flow_network_nodes = extractor.flow_hg_builder.numNodes();
+        _context.stats.set(StatTag::LocalSearch, "flowNetworkMaxBytes",
+                           _max_flow_network_nodes * kFlowNetworkBytesPerNode);
+      }
+
       if (STF.cutAtStake - STF.baseCut <= 0) {
         break;
       }
@@ -161,7 +178,9 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
       
       hfc.reset();
       hfc.upperFlowBound = STF.cutAtStake - STF.baseCut;
+      ScopedPerfCounter perf_counter(PerfRegion::flow);
       bool flowcutter_succeeded = hfc.runUntilBalancedOrFlowBoundExceeded(STF.source, STF.target);
+      perf_counter.stop();
       HyperedgeWeight newCut = STF.baseCut + hfc.cs.flowValue;
 
       bool should_update = false;
@@ -211,6 +230,12 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
 
     HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
     Timer::instance().add(_context, Timepoint::flow_refinement, std::chrono::duration<double>(end - start).count());
+    if (unlikely(Tracer::instance().isEnabled())) {
+      Tracer::instance().add("flow", "flow refinement", start, end,
+                             TraceArgs().add("b0", b0).add("b1", b1)
+                             .add("nodes", _hg.currentNumNodes())
+                             .add("improved", improved).release());
+    }
 
     time_limit::isSoftTimeLimitExceeded(_context);
 
@@ -309,6 +334,7 @@ class TwoWayHyperFlowCutterRefiner final : public IRefiner,
   whfc::HyperFlowCutter<whfc::Dinic> hfc;
   QuotientGraphBlockScheduler* _quotient_graph;
   bool _ignore_flow_execution_policy;
+  size_t _max_flow_network_nodes;
   PartitionID b0;
   PartitionID b1;
 };
@@ -96,7 +96,8 @@ class KWayHyperFlowCutterRefiner final : public IRefiner,
     bool active_block_exist = true;
     std::vector<bool> active_blocks(_context.partition.k, true);
     size_t current_round = 1;
-    while (active_block_exist && !time_limit::isSoftTimeLimitExceeded(_context)) {
+    while (active_block_exist &&
+           !time_limit::isTimeLimitExceeded(_context, TimeLimitPhase::flow_refinement)) {
       scheduler.randomShuffleQuotientEdges();
       std::vector<bool> tmp_active_blocks(_context.partition.k, false);
       active_block_exist = false;
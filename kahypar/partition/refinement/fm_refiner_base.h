@@ -31,10 +31,11 @@
 #include "kahypar/partition/refinement/uncontraction_gain_changes.h"
 
 namespace kahypar {
+// Since each hypernode is moved at most once per FM pass, the target part of a
+// move is the current part of the hypernode during rollback.
 struct RollbackInfo {
   HypernodeID hn;
   PartitionID from_part;
-  PartitionID to_part;
 };
 
 template <typename RollbackElement = Mandatory,
@@ -82,7 +83,6 @@ class FMRefinerBase {
     _pq(context.partition.k),
     _performed_moves(),
     _hns_to_activate() {
-    _performed_moves.reserve(_hg.initialNumNodes());
     _hns_to_activate.reserve(_hg.initialNumNodes());
   }
 
@@ -204,16 +204,20 @@ class FMRefinerBase {
     _performed_moves.clear();
   }
 
-  void rollback(int last_index, const int min_cut_index) {
-    DBG << "min_cut_index=" << min_cut_index;
-    DBG << "last_index=" << last_index;
-    while (last_index != min_cut_index) {
-      const HypernodeID hn = _performed_moves[last_index].hn;
-      const PartitionID from_part = _performed_moves[last_index].to_part;
-      const PartitionID to_part = _performed_moves[last_index].from_part;
-      _hg.changeNodePart(hn, from_part, to_part);
-      --last_index;
+  // _performed_moves only contains the moves since the last improvement. All moves
+  // up to the best solution found so far are committed, i.e., they are never rolled
+  // back. Thus, memory and rollback time only depend on the number of moves since the
+  // last improvement.
+  void commitPerformedMoves() {
+    _performed_moves.clear();
+  }
+
+  void rollback() {
+    DBG << "rolling back" << _performed_moves.size() << "moves";
+    for (auto rit = _performed_moves.crbegin(); rit != _performed_moves.crend(); ++rit) {
+      _hg.changeNodePart(rit->hn, _hg.partID(rit->hn), rit->from_part);
     }
+    _performed_moves.clear();
   }
 
   Hypergraph& _hg;
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <limits>
 
 namespace kahypar {
@@ -29,20 +30,35 @@ enum class RollbackAction : char {
   do_nothing
 };
 
-struct RollbackElement {
-  const HypernodeID hn;
-  const PartitionID part;
-  const Gain delta;
-  const RollbackAction action;
-
+// Rollback information for one gain cache change. The rollback action is stored in
+// the two lowest bits of the part to keep the element at 12 bytes.
+class RollbackElement {
+ public:
   RollbackElement(const HypernodeID hn_,
                   const PartitionID part_,
                   const Gain delta_,
                   const RollbackAction act) :
     hn(hn_),
-    part(part_),
     delta(delta_),
-    action(act) { }
+    _part_and_action((static_cast<uint32_t>(part_) << kActionBits) | static_cast<uint32_t>(act)) {
+    ASSERT(part_ >= 0 && static_cast<uint32_t>(part_) < (1U << (32 - kActionBits)), V(part_));
+  }
+
+  PartitionID part() const {
+    return static_cast<PartitionID>(_part_and_action >> kActionBits);
+  }
+
+  RollbackAction action() const {
+    return static_cast<RollbackAction>(_part_and_action & ((1U << kActionBits) - 1));
+  }
+
+  const HypernodeID hn;
+  const Gain delta;
+
+ private:
+  static constexpr uint32_t kActionBits = 2;
+
+  const uint32_t _part_and_action;
 };
 
 // Internal structure for cache entries.
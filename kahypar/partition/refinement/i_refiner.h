@@ -66,6 +66,11 @@ class IRefiner {
     return rollbackImpl();
   }
 
+  // Bytes held by the gain cache(s) of the refiner.
+  size_t memoryConsumption() const {
+    return memoryConsumptionImpl();
+  }
+
  protected:
   IRefiner() = default;
   bool _is_initialized = false;
@@ -83,5 +88,7 @@ class IRefiner {
                                               const UncontractionGainChanges&) { }
 
   virtual std::vector<Move> rollbackImpl() { return std::vector<Move>(); }
+
+  virtual size_t memoryConsumptionImpl() const { return 0; }
 };
 }  // namespace kahypar
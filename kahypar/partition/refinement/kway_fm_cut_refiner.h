@@ -42,6 +42,7 @@
 #include "kahypar/partition/refinement/kway_fm_gain_cache.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
 #include "kahypar/utils/float_compare.h"
+#include "kahypar/utils/perf_counters.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -88,6 +89,11 @@ class KWayFMRefiner final : public IRefiner,
   FRIEND_TEST(AKwayFMRefinerDeathTest, ConsidersSingleNodeHEsDuringInitialGainComputation);
   FRIEND_TEST(AKwayFMRefinerDeathTest, ConsidersSingleNodeHEsDuringInducedGainComputation);
   FRIEND_TEST(AKwayFMRefiner, KnowsIfAHyperedgeIsFullyActive);
+  FRIEND_TEST(AKwayFMRefiner, OnlyKeepsMovesSinceTheLastImprovement);
+
+  size_t memoryConsumptionImpl() const override final {
+    return _gain_cache.memoryConsumption();
+  }
 
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     if (!_is_initialized) {
@@ -139,10 +145,10 @@ class KWayFMRefiner final : public IRefiner,
     HyperedgeWeight current_cut = best_metrics.cut;
     double current_imbalance = best_metrics.imbalance;
 
-    int min_cut_index = -1;
     int touched_hns_since_last_improvement = 0;
     _stopping_policy.resetStatistics();
 
+    ScopedPerfCounter perf_counter(PerfRegion::fm_moves);
     const double beta = log(_hg.currentNumNodes());
     while (!_pq.empty() &&
            !_stopping_policy.searchShouldStop(touched_hns_since_last_improvement,
@@ -210,6 +216,7 @@ class KWayFMRefiner final : public IRefiner,
                V(current_imbalance) << V(metrics::imbalance(_hg, _context)));
 
         updateNeighbours(max_gain_node, from_part, to_part);
+        _performed_moves.emplace_back(RollbackInfo { max_gain_node, from_part });
 
         // right now, we do not allow a decrease in cut in favor of an increase in balance
         const bool improved_cut_within_balance = (current_imbalance <= _context.partition.epsilon) &&
@@ -228,20 +235,20 @@ class KWayFMRefiner final : public IRefiner,
           best_metrics.cut = current_cut;
           best_metrics.imbalance = current_imbalance;
           _stopping_policy.resetStatistics();
-          min_cut_index = _performed_moves.size();
           touched_hns_since_last_improvement = 0;
+          Base::commitPerformedMoves();
           _gain_cache.resetDelta();
         }
-        _performed_moves.emplace_back(RollbackInfo { max_gain_node, from_part, to_part });
       }
     }
-    DBG << "KWayFM performed" << _performed_moves.size()
-        << "local search movements ( min_cut_index=" << min_cut_index << "): stopped because of "
+    perf_counter.stop();
+    DBG << "KWayFM stopped with" << _performed_moves.size()
+        << "local search movements since the last improvement because of "
         << (_stopping_policy.searchShouldStop(touched_hns_since_last_improvement, _context, beta,
                                           best_metrics.cut, current_cut)
         == true ? "policy" : "empty queue");
 
-    Base::rollback(_performed_moves.size() - 1, min_cut_index);
+    Base::rollback();
     _gain_cache.rollbackDelta();
 
     ASSERT_THAT_GAIN_CACHE_IS_VALID();
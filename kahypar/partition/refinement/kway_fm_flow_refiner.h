@@ -58,6 +58,10 @@ class KWayFMFlowRefiner final : public IRefiner,
   KWayFMFlowRefiner& operator= (KWayFMFlowRefiner&&) = delete;
 
  private:
+  size_t memoryConsumptionImpl() const override final {
+    return _fm_refiner->memoryConsumption() + _flow_refiner->memoryConsumption();
+  }
+
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     _fm_refiner->initialize(max_gain);
     _flow_refiner->initialize(max_gain);
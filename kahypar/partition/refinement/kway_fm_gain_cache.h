@@ -62,6 +62,19 @@ class KwayGainCache {
   KwayGainCache(KwayGainCache&&) = default;
   KwayGainCache& operator= (KwayGainCache&&) = default;
 
+  // Cache elements are allocated lazily, i.e., only for hypernodes
+  // for which gains have been cached so far.
+  size_t memoryConsumption() const {
+    size_t memory = _num_hns * sizeof(KFMCacheElement*) +
+                    _deltas.capacity() * sizeof(RollbackElement);
+    for (size_t i = 0; i < _num_hns; ++i) {
+      if (_cache[i] != nullptr) {
+        memory += _cache_element_size;
+      }
+    }
+    return memory;
+  }
+
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE Gain entry(const HypernodeID hn, const PartitionID part) const {
     DBGC(hn == hn_to_debug) << "entry access for HN" << hn << "and part" << part;
     ASSERT(_cache[hn] != nullptr);
@@ -176,21 +189,21 @@ class KwayGainCache {
   void rollbackDelta() {
     for (auto rit = _deltas.crbegin(); rit != _deltas.crend(); ++rit) {
       const HypernodeID hn = rit->hn;
-      const PartitionID part = rit->part;
+      const PartitionID part = rit->part();
       const Gain delta = rit->delta;
       if (cacheElement(hn)->contains(part)) {
         DBGC(hn == hn_to_debug) << "rollback:" << "G[" << hn << "," << part << "]="
                                 << cacheElement(hn)->gain(part) << "+" << delta << "="
                                 << (cacheElement(hn)->gain(part) + delta);
         cacheElement(hn)->update(part, delta);
-        if (rit->action == RollbackAction::do_remove) {
+        if (rit->action() == RollbackAction::do_remove) {
           ASSERT(cacheElement(hn)->gain(part) == kNotCached, V(hn));
           cacheElement(hn)->remove(part);
         }
       } else {
         DBGC(hn == hn_to_debug) << "rollback: SET" << "set G[" << hn << "," << part << "]=" << delta;
         cacheElement(hn)->set(part, delta);
-        if (rit->action == RollbackAction::do_add) {
+        if (rit->action() == RollbackAction::do_add) {
           cacheElement(hn)->addToActiveParts(part);
         }
       }
@@ -43,24 +43,38 @@
 #include "kahypar/partition/refinement/kway_fm_gain_cache.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
 #include "kahypar/utils/float_compare.h"
+#include "kahypar/utils/perf_counters.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
+// The objective policy selects the optimized metric: Km1Objective optimizes the
+// connectivity metric, SoedObjective optimizes the sum of external degrees
+// soed(P) = sum_{e in cut} lambda(e) * w(e) = km1(P) + cut(P).
+// The soed gain of a move is the sum of its km1 gain and its cut gain. The cut
+// part only changes if a hyperedge becomes cut/internal or if all but one of its
+// pins are contained in the source or target part of the move.
 template <class StoppingPolicy = Mandatory,
-          class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased>
+          class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased,
+          class ObjectivePolicy = Km1Objective>
 class KWayKMinusOneRefiner final : public IRefiner,
-                                   private FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy, FMImprovementPolicy> >{
+                                   private FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy, FMImprovementPolicy, ObjectivePolicy> >{
  private:
   static constexpr bool enable_heavy_assert = false;
   static constexpr bool debug = false;
   static constexpr HypernodeID hn_to_debug = 5589;
+  static constexpr bool optimize_soed = ObjectivePolicy::objective == Objective::soed;
+
+  static_assert(ObjectivePolicy::objective == Objective::km1 || optimize_soed,
+                "KWayKMinusOneRefiner only optimizes km1 or soed");
 
   using GainCache = KwayGainCache<Gain>;
   using Base = FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy,
-                                                                FMImprovementPolicy> >;
+                                                                FMImprovementPolicy,
+                                                                ObjectivePolicy> >;
 
   friend class FMRefinerBase<RollbackInfo, KWayKMinusOneRefiner<StoppingPolicy,
-                                                                FMImprovementPolicy> >;
+                                                                FMImprovementPolicy,
+                                                                ObjectivePolicy> >;
 
   using HEState = typename Base::HEState;
   using Base::kInvalidGain;
@@ -98,10 +112,18 @@ class KWayKMinusOneRefiner final : public IRefiner,
   KWayKMinusOneRefiner& operator= (KWayKMinusOneRefiner&&) = delete;
 
  private:
+  FRIEND_TEST(AKWaySOEDRefiner, ComputesSoedGainOfHypernodeMovement);
+  FRIEND_TEST(AKWaySOEDRefiner, MaintainsCorrectGainsDuringLocalSearch);
+
+  size_t memoryConsumptionImpl() const override final {
+    return _gain_cache.memoryConsumption();
+  }
+
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     if (!_is_initialized) {
 #ifdef USE_BUCKET_QUEUE
-      _pq.initialize(_hg.initialNumNodes(), max_gain);
+      // The soed gain of a move is bounded by twice its km1 gain.
+      _pq.initialize(_hg.initialNumNodes(), optimize_soed ? 2 * max_gain : max_gain);
 #else
       unused(max_gain);
       _pq.initialize(_hg.initialNumNodes());
@@ -126,6 +148,8 @@ class KWayKMinusOneRefiner final : public IRefiner,
                   Metrics& best_metrics) override final {
     HEAVY_REFINEMENT_ASSERT(best_metrics.km1 == metrics::km1(_hg),
            V(best_metrics.km1) << V(metrics::km1(_hg)));
+    HEAVY_REFINEMENT_ASSERT(!optimize_soed || best_metrics.cut == metrics::hyperedgeCut(_hg),
+           V(best_metrics.cut) << V(metrics::hyperedgeCut(_hg)));
     HEAVY_REFINEMENT_ASSERT(FloatingPoint<double>(best_metrics.imbalance).AlmostEquals(
              FloatingPoint<double>(metrics::imbalance(_hg, _context))),
            V(best_metrics.imbalance) << V(metrics::imbalance(_hg, _context)));
@@ -144,24 +168,26 @@ class KWayKMinusOneRefiner final : public IRefiner,
 
     const double initial_imbalance = best_metrics.imbalance;
     double current_imbalance = best_metrics.imbalance;
-    const HyperedgeWeight initial_km1 = best_metrics.km1;
-    HyperedgeWeight current_km1 = best_metrics.km1;
+    const HyperedgeWeight initial_objective = ObjectivePolicy::value(best_metrics);
+    HyperedgeWeight best_objective = initial_objective;
+    HyperedgeWeight current_objective = initial_objective;
+    HyperedgeWeight current_cut = best_metrics.cut;
 
-    int min_cut_index = -1;
     int touched_hns_since_last_improvement = 0;
     _stopping_policy.resetStatistics();
 
+    ScopedPerfCounter perf_counter(PerfRegion::fm_moves);
     const double beta = log(_hg.currentNumNodes());
     while (!_pq.empty() && !_stopping_policy.searchShouldStop(touched_hns_since_last_improvement,
-                                                              _context, beta, best_metrics.km1,
-                                                              current_km1)) {
+                                                              _context, beta, best_objective,
+                                                              current_objective)) {
       Gain max_gain = kInvalidGain;
       HypernodeID max_gain_node = kInvalidHN;
       PartitionID to_part = Hypergraph::kInvalidPartition;
       _pq.deleteMax(max_gain_node, max_gain, to_part);
       const PartitionID from_part = _hg.partID(max_gain_node);
 
-      DBG << V(current_km1) << V(max_gain_node) << V(max_gain)
+      DBG << V(current_objective) << V(max_gain_node) << V(max_gain)
           << V(_hg.partID(max_gain_node)) << V(to_part);
 
       ASSERT(!_hg.marked(max_gain_node), V(max_gain_node));
@@ -203,35 +229,44 @@ class KWayKMinusOneRefiner final : public IRefiner,
 
         current_imbalance = metrics::imbalance(_hg, _context);
 
-        current_km1 -= max_gain;
+        current_objective -= max_gain;
         _stopping_policy.updateStatistics(max_gain);
 
-        HEAVY_REFINEMENT_ASSERT(current_km1 == metrics::km1(_hg),
-               V(current_km1) << V(metrics::km1(_hg)));
+        HEAVY_REFINEMENT_ASSERT(current_objective == ObjectivePolicy::compute(_hg),
+               V(current_objective) << V(ObjectivePolicy::compute(_hg)));
         HEAVY_REFINEMENT_ASSERT(current_imbalance == metrics::imbalance(_hg, _context),
                V(current_imbalance) << V(metrics::imbalance(_hg, _context)));
 
-        updateNeighbours(max_gain_node, from_part, to_part);
+        current_cut += updateNeighbours(max_gain_node, from_part, to_part);
+        _performed_moves.emplace_back(RollbackInfo { max_gain_node, from_part });
+
+        HEAVY_REFINEMENT_ASSERT(!optimize_soed || current_cut == metrics::hyperedgeCut(_hg),
+               V(current_cut) << V(metrics::hyperedgeCut(_hg)));
 
         // right now, we do not allow a decrease in cut in favor of an increase in balance
-        const bool improved_km1_within_balance = (current_imbalance <= _context.partition.epsilon) &&
-                                                 (current_km1 < best_metrics.km1);
-        const bool improved_balance_less_equal_km1 = (current_imbalance < best_metrics.imbalance) &&
-                                                     (current_km1 <= best_metrics.km1);
+        const bool improved_objective_within_balance = (current_imbalance <= _context.partition.epsilon) &&
+                                                       (current_objective < best_objective);
+        const bool improved_balance_less_equal_objective = (current_imbalance < best_metrics.imbalance) &&
+                                                           (current_objective <= best_objective);
 
-        if (improved_km1_within_balance || improved_balance_less_equal_km1) {
+        if (improved_objective_within_balance || improved_balance_less_equal_objective) {
           DBGC(max_gain == 0) << "KWayFM improved balance between" << from_part
                               << "and" << to_part << "(max_gain=" << max_gain << ")";
-          DBGC(current_km1 < best_metrics.km1) << "KWayFM improved cut from "
-                                               << best_metrics.km1 << "to" << current_km1;
-          best_metrics.km1 = current_km1;
+          DBGC(current_objective < best_objective) << "KWayFM improved" << ObjectivePolicy::objective
+                                                   << "from" << best_objective << "to" << current_objective;
+          best_objective = current_objective;
+          if (optimize_soed) {
+            best_metrics.cut = current_cut;
+            best_metrics.km1 = current_objective - current_cut;
+          } else {
+            best_metrics.km1 = current_objective;
+          }
           best_metrics.imbalance = current_imbalance;
           _stopping_policy.resetStatistics();
-          min_cut_index = _performed_moves.size();
           touched_hns_since_last_improvement = 0;
+          Base::commitPerformedMoves();
           _gain_cache.resetDelta();
         }
-        _performed_moves.emplace_back(RollbackInfo { max_gain_node, from_part, to_part });
       } else {
         // If the HN can't be moved to to_part, it locks all its incident
         // HEs in from_part (i.e., from_part becomes unremovable).
@@ -251,22 +286,24 @@ class KWayKMinusOneRefiner final : public IRefiner,
         }
       }
     }
-    DBG << "KWayFM performed "
+    perf_counter.stop();
+    DBG << "KWayFM stopped with"
         << _performed_moves.size()
-        << "local search movements ( min_cut_index=" << min_cut_index << "): stopped because of "
+        << "local search movements since the last improvement because of "
         << (_stopping_policy.searchShouldStop(touched_hns_since_last_improvement, _context, beta,
-                                          best_metrics.km1, current_km1)
+                                          best_objective, current_objective)
         == true ? "policy" : "empty queue");
 
-    Base::rollback(_performed_moves.size() - 1, min_cut_index);
+    Base::rollback();
     _gain_cache.rollbackDelta();
 
     ASSERT_THAT_GAIN_CACHE_IS_VALID();
 
     HEAVY_REFINEMENT_ASSERT(best_metrics.km1 == metrics::km1(_hg));
-    ASSERT(best_metrics.km1 <= initial_km1, V(initial_km1) << V(best_metrics.km1));
+    HEAVY_REFINEMENT_ASSERT(!optimize_soed || best_metrics.cut == metrics::hyperedgeCut(_hg));
+    ASSERT(best_objective <= initial_objective, V(initial_objective) << V(best_objective));
 
-    return FMImprovementPolicy::improvementFound(best_metrics.km1, initial_km1,
+    return FMImprovementPolicy::improvementFound(best_objective, initial_objective,
                                                  best_metrics.imbalance, initial_imbalance,
                                                  _context.partition.epsilon);
   }
@@ -337,6 +374,66 @@ class KWayKMinusOneRefiner final : public IRefiner,
     }
   }
 
+  // Updates the cut part of the gains of all pins of he. The cut gain of moving pin
+  // to part t is w(he) if all other pins are in t and -w(he) if he is internal.
+  // Moves to parts that became adjacent due to the current move are excluded,
+  // since their gains were calculated from scratch.
+  template <bool only_update_cache = false>
+  void cutDeltaGainUpdates(const HypernodeID moved_hn, const PartitionID from_part,
+                           const PartitionID to_part, const HyperedgeID he) {
+    const HypernodeID he_size = _hg.edgeSize(he);
+    const HypernodeID pin_count_from_part_before_move = _hg.pinCountInPart(he, from_part) + 1;
+    const HypernodeID pin_count_to_part_after_move = _hg.pinCountInPart(he, to_part);
+    const HyperedgeWeight he_weight = _hg.edgeWeight(he);
+
+    if (pin_count_from_part_before_move == he_size || pin_count_to_part_after_move == he_size) {
+      // he became cut (internal) and thus moving any other pin does no longer
+      // (now does) cut he.
+      const Gain delta = pin_count_from_part_before_move == he_size ? he_weight : -he_weight;
+      for (const HypernodeID& pin : _hg.pins(he)) {
+        if (pin != moved_hn) {
+          for (const PartitionID& part : _gain_cache.adjacentParts(pin)) {
+            cutDeltaGainUpdate<only_update_cache>(pin, part, he, delta);
+          }
+        }
+      }
+    }
+    if (pin_count_to_part_after_move == he_size - 1) {
+      // Moving the only pin not contained in to_part now makes he internal.
+      for (const HypernodeID& pin : _hg.pins(he)) {
+        if (_hg.partID(pin) != to_part) {
+          if (_gain_cache.entryExists(pin, to_part)) {
+            cutDeltaGainUpdate<only_update_cache>(pin, to_part, he, he_weight);
+          }
+          break;
+        }
+      }
+    }
+    if (pin_count_from_part_before_move == he_size - 1) {
+      // Moving the only pin not contained in from_part no longer makes he internal.
+      for (const HypernodeID& pin : _hg.pins(he)) {
+        if (_hg.partID(pin) != from_part && pin != moved_hn) {
+          if (_gain_cache.entryExists(pin, from_part)) {
+            cutDeltaGainUpdate<only_update_cache>(pin, from_part, he, -he_weight);
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  template <bool only_update_cache = false>
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void cutDeltaGainUpdate(const HypernodeID pin,
+                                                          const PartitionID part,
+                                                          const HyperedgeID he,
+                                                          const Gain delta) {
+    if (_new_adjacent_part.get(pin) != part) {
+      if (!only_update_cache && _hg.active(pin) && !_hg.marked(pin)) {
+        updatePin(pin, part, he, delta);
+      }
+      _gain_cache.updateExistingEntry(pin, part, delta);
+    }
+  }
 
   void connectivityUpdateForCache(const HypernodeID pin, const PartitionID from_part,
                                   const PartitionID to_part, const HyperedgeID he,
@@ -590,28 +687,43 @@ class KWayKMinusOneRefiner final : public IRefiner,
     updateNeighbours<true>(moved_hn, from_part, to_part);
   }
 
+  // Returns the change of the cut metric induced by the move, if soed is optimized.
   template <bool only_update_cache = false>
-  void updateNeighbours(const HypernodeID moved_hn, const PartitionID from_part,
-                        const PartitionID to_part) {
+  HyperedgeWeight updateNeighbours(const HypernodeID moved_hn, const PartitionID from_part,
+                                   const PartitionID to_part) {
     _new_adjacent_part.resetUsedEntries();
 
+    HyperedgeWeight cut_delta = 0;
     bool moved_hn_remains_conntected_to_from_part = false;
     for (const HyperedgeID& he : _hg.incidentEdges(moved_hn)) {
       const HypernodeID pins_in_source_part_after = _hg.pinCountInPart(he, from_part);
+      const HypernodeID pins_in_target_part_after = _hg.pinCountInPart(he, to_part);
+      const HyperedgeWeight he_weight = _hg.edgeWeight(he);
 
       ASSERT(!_gain_cache.entryExists(moved_hn, from_part), V(moved_hn) << V(from_part));
       moved_hn_remains_conntected_to_from_part |= pins_in_source_part_after != 0;
 
-      if (pins_in_source_part_after == 0 && _hg.pinCountInPart(he, to_part) != 1) {
-        for (const PartitionID& part : _gain_cache.adjacentParts(moved_hn)) {
-          if (part != from_part && part != to_part) {
-            _gain_cache.updateExistingEntry(moved_hn, part, -_hg.edgeWeight(he));
-          }
+      // km1 part of the gains of moved_hn
+      Gain delta = 0;
+      if (pins_in_source_part_after == 0 && pins_in_target_part_after != 1) {
+        delta -= he_weight;
+      } else if (pins_in_source_part_after != 0 && pins_in_target_part_after == 1) {
+        delta += he_weight;
+      }
+      // cut part of the gains of moved_hn
+      if (optimize_soed) {
+        if (pins_in_source_part_after + 1 == _hg.edgeSize(he)) {
+          delta += he_weight;
+          cut_delta += he_weight;
+        } else if (pins_in_target_part_after == _hg.edgeSize(he)) {
+          delta -= he_weight;
+          cut_delta -= he_weight;
         }
-      } else if (pins_in_source_part_after != 0 && _hg.pinCountInPart(he, to_part) == 1) {
+      }
+      if (delta != 0) {
         for (const PartitionID& part : _gain_cache.adjacentParts(moved_hn)) {
           if (part != from_part && part != to_part) {
-            _gain_cache.updateExistingEntry(moved_hn, part, _hg.edgeWeight(he));
+            _gain_cache.updateExistingEntry(moved_hn, part, delta);
           }
         }
       }
@@ -623,6 +735,9 @@ class KWayKMinusOneRefiner final : public IRefiner,
       } else {
         fullUpdate<only_update_cache>(moved_hn, from_part, to_part, he);
       }
+      if (optimize_soed) {
+        cutDeltaGainUpdates<only_update_cache>(moved_hn, from_part, to_part, he);
+      }
       _unremovable_he_parts.set(static_cast<size_t>(he) * _context.partition.k + to_part, 1);
 
       HEAVY_REFINEMENT_ASSERT([&]() {
@@ -784,6 +899,7 @@ class KWayKMinusOneRefiner final : public IRefiner,
         }
         return true;
       } (), V(moved_hn));
+    return cut_delta;
   }
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updatePin(const HypernodeID pin, const PartitionID part,
@@ -842,6 +958,10 @@ class KWayKMinusOneRefiner final : public IRefiner,
     const HyperedgeWeight he_weight = _hg.edgeWeight(he);
     Gain gain = pins_in_source_part == 1 ? he_weight : 0;
     gain -= pins_in_target_part == 0 ? he_weight : 0;
+    if (optimize_soed) {
+      gain += pins_in_target_part == _hg.edgeSize(he) - 1 ? he_weight : 0;
+      gain -= pins_in_source_part == _hg.edgeSize(he) ? he_weight : 0;
+    }
     return gain;
   }
 
@@ -868,9 +988,13 @@ class KWayKMinusOneRefiner final : public IRefiner,
     for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
       const HyperedgeWeight he_weight = _hg.edgeWeight(he);
       internal += _hg.pinCountInPart(he, source_part) != 1 ? he_weight : 0;
+      if (optimize_soed) {
+        internal += _hg.pinCountInPart(he, source_part) == _hg.edgeSize(he) ? he_weight : 0;
+      }
       for (const PartitionID& part : _hg.connectivitySet(he)) {
         ASSERT(part < _context.partition.k, V(part));
-        _tmp_gains[part] += he_weight;
+        _tmp_gains[part] += optimize_soed && _hg.pinCountInPart(he, part) == _hg.edgeSize(he) - 1 ?
+                            2 * he_weight : he_weight;
       }
     }
 
@@ -976,4 +1100,8 @@ class KWayKMinusOneRefiner final : public IRefiner,
   GainCache _gain_cache;
   StoppingPolicy _stopping_policy;
 };
+
+template <class StoppingPolicy = Mandatory,
+          class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased>
+using KWaySOEDRefiner = KWayKMinusOneRefiner<StoppingPolicy, FMImprovementPolicy, SoedObjective>;
 }  // namespace kahypar
@@ -19,6 +19,7 @@
  ******************************************************************************/
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <iostream>
 #include <limits>
@@ -28,21 +29,27 @@
 #include <utility>
 #include <vector>
 
+#include "kahypar/datastructure/scratch_memory.h"
 #include "kahypar/definitions.h"
 #include "kahypar/io/hypergraph_io.h"
 #include "kahypar/io/partitioning_output.h"
 #include "kahypar/io/sql_plottools_serializer.h"
 #include "kahypar/kahypar.h"
 #include "kahypar/macros.h"
+#include "kahypar/partition/anytime_solution_reporter.h"
 #include "kahypar/partition/evo_partitioner.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/utils/math.h"
+#include "kahypar/utils/perf_counters.h"
+#include "kahypar/utils/progress.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 class PartitionerFacade {
  public:
   void partition(Hypergraph& hypergraph, Context& context) {
+    progress::beginPartitioningCall(context);
     io::printBanner(context);
 
     sanityCheck(hypergraph, context);
@@ -57,18 +64,75 @@ class PartitionerFacade {
       setupVcycleRefinement(hypergraph, context);
     }
 
+    if (!context.partition.trace_filename.empty()) {
+      Tracer::instance().enable();
+    }
+
+    if (context.partition.perf_counters && !PerfCounters::instance().enable()) {
+      LOG << "WARNING: hardware performance counters are not available."
+          << "KaHyPar has to be built with -DKAHYPAR_ENABLE_PERF_COUNTERS=ON on Linux"
+          << "and perf_event_open has to be permitted (see /proc/sys/kernel/perf_event_paranoid).";
+      context.partition.perf_counters = false;
+    }
+
+    ImprovedSolutionCallback improved_solution_callback = context.partition.improved_solution_callback;
+    if (context.partition.anytime_partition_output && context.partition.write_partition_file) {
+      improved_solution_callback = [&context](const std::vector<PartitionID>& partition,
+                                              const HyperedgeWeight objective,
+                                              const double imbalance) {
+        writePartitionFileAtomically(partition, context.partition.graph_partition_filename);
+        if (context.partition.improved_solution_callback) {
+          context.partition.improved_solution_callback(partition, objective, imbalance);
+        }
+      };
+    }
+    std::unique_ptr<AnytimeSolutionReporter> anytime_reporter;
+    if (improved_solution_callback) {
+      anytime_reporter = std::make_unique<AnytimeSolutionReporter>(hypergraph,
+                                                                   improved_solution_callback);
+      context.partition.anytime_reporter = anytime_reporter.get();
+    }
+
     const auto time_and_iteration = performPartitioning(hypergraph, context);
+    context.partition.anytime_reporter = nullptr;
+    // Scratch memory is only reused within a partitioning call
+    ds::ScratchMemory::instance().release();
+    if (progress::isCancellationRequested(context)) {
+      LOGCC(!context.partition.quiet_mode, true)
+        << "WARNING: partitioning was cancelled. The partition might be of low quality.";
+    }
     const std::chrono::duration<double> elapsed_seconds = time_and_iteration.first;
     const size_t iteration = time_and_iteration.second;
 
+    if (!context.partition.trace_filename.empty()) {
+      Tracer::instance().disable();
+      Tracer::instance().writeChromeTrace(context.partition.trace_filename);
+    }
+
+    if (context.partition.perf_counters) {
+      PerfCounters::instance().disable();
+    }
+
     io::printFinalPartitioningResults(hypergraph, context, elapsed_seconds);
     if (context.partition.write_partition_file) {
-      io::writePartitionFile(hypergraph, context.partition.graph_partition_filename);
+      if (context.partition.anytime_partition_output) {
+        // The partition file may be read at any time and therefore is only written
+        // atomically. It always ends up containing the final partition.
+        std::vector<PartitionID> partition;
+        partition.reserve(hypergraph.initialNumNodes());
+        for (const HypernodeID& hn : hypergraph.nodes()) {
+          partition.push_back(hypergraph.partID(hn));
+        }
+        writePartitionFileAtomically(partition, context.partition.graph_partition_filename);
+      } else {
+        io::writePartitionFile(hypergraph, context.partition.graph_partition_filename);
+      }
     }
 
     if (context.partition.sp_process_output) {
       io::serializer::serialize(context, hypergraph, elapsed_seconds, iteration);
     }
+    progress::endPartitioningCall(context);
   }
 
  private:
@@ -130,7 +194,8 @@ class PartitionerFacade {
     double best_imbalance = 1.0;
 
     Partitioner partitioner;
-    while (elapsed_time.count() < context.partition.time_limit) {
+    while (elapsed_time.count() < context.partition.time_limit &&
+           (iteration == 0 || !progress::isCancellationRequested(context))) {
       const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
       partitioner.partition(hypergraph, context);
       const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
@@ -180,6 +245,10 @@ class PartitionerFacade {
                                                                        Context& context) {
     size_t iteration = 0;
     context.partition.start_time = std::chrono::high_resolution_clock::now();
+    context.partition.time_limit_triggered = false;
+    // Copies of the context made by the caller might be used by concurrent calls.
+    context.partition.time_limited_phases =
+      std::make_shared<std::array<bool, static_cast<size_t>(TimeLimitPhase::COUNT)> >();
     if (context.partition.time_limited_repeated_partitioning && !context.partition_evolutionary) {
       iteration = performTimeLimitedRepeatedPartitioning(hypergraph, context);
     } else if (context.partition_evolutionary && context.partition.time_limit > 0) {
@@ -206,7 +206,46 @@ static inline int __builtin_clzll(unsigned long long mask) {
 #endif
   return 64;
 }
+
+static inline int __builtin_ctzll(unsigned long long mask) {
+  unsigned long where;
+  // BitScanForward scans from LSB to MSB for first set bit.
+#if defined(KAHYPAR_HAS_BITSCAN64)
+  if (_BitScanForward64(&where, mask)) {
+    return static_cast<int>(where);
+  }
+#else
+  // Scan the low 32 bits.
+  if (_BitScanForward(&where, static_cast<unsigned long>(mask))) {
+    return static_cast<int>(where);
+  }
+  // Scan the high 32 bits.
+  if (_BitScanForward(&where, static_cast<unsigned long>(mask >> 32))) {
+    return static_cast<int>(where + 32);
+  }
 #endif
+  return 64;
+}
+
+static inline int __builtin_popcountll(unsigned long long mask) {
+  // see: http://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel
+  mask = mask - ((mask >> 1) & 0x5555555555555555ULL);
+  mask = (mask & 0x3333333333333333ULL) + ((mask >> 2) & 0x3333333333333333ULL);
+  mask = (mask + (mask >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<int>((mask * 0x0101010101010101ULL) >> 56);
+}
+#endif
+
+// ! Index of the least significant set bit. mask must not be zero.
+static inline int countTrailingZeros(const uint64_t mask) {
+  ASSERT(mask != 0);
+  return __builtin_ctzll(mask);
+}
+
+// ! Number of set bits
+static inline int popcount(const uint64_t mask) {
+  return __builtin_popcountll(mask);
+}
 
 
 // see: http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "kahypar/utils/stats.h"
+
+namespace kahypar {
+namespace memory {
+#if defined(__linux__)
+// Returns the value of the given field (e.g. "VmHWM:") of /proc/self/status in bytes.
+static inline size_t procStatusField(const std::string& field) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, field.size(), field) == 0) {
+      return std::stoull(line.substr(field.size())) * 1024;
+    }
+  }
+  return 0;
+}
+#endif
+
+// Returns the current resident set size of the process in bytes
+// or 0 if it cannot be determined on this platform.
+static inline size_t currentRSS() {
+#if defined(__linux__)
+  return procStatusField("VmRSS:");
+#else
+  return 0;
+#endif
+}
+
+// Returns the peak resident set size of the process in bytes
+// or 0 if it cannot be determined on this platform. On Linux, the peak
+// is measured since the last call to resetPeakRSS().
+static inline size_t peakRSS() {
+#if defined(__linux__)
+  const size_t vm_hwm = procStatusField("VmHWM:");
+  if (vm_hwm > 0) {
+    return vm_hwm;
+  }
+#endif
+#if defined(__APPLE__)
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<size_t>(usage.ru_maxrss);
+#elif defined(__unix__)
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#else
+  return 0;
+#endif
+}
+
+// Resets the peak resident set size to the current resident set size.
+// Only supported on Linux >= 4.0, returns false otherwise.
+static inline bool resetPeakRSS() {
+#if defined(__linux__)
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return clear_refs.good();
+#else
+  return false;
+#endif
+}
+
+// Records the current and the peak resident set size of the process at the end
+// of the given phase of the top-level partitioning call. Since the peak is
+// monotone, the phase responsible for the overall peak is the first phase
+// whose peakRSS equals the final value.
+template <typename Context>
+static inline void recordRSS(const Context& context, const StatTag tag) {
+  if (context.type == ContextType::main) {
+    context.stats.set(tag, "currentRSS", currentRSS());
+    context.stats.set(tag, "peakRSS", peakRSS());
+  }
+}
+}  // namespace memory
+}  // namespace kahypar
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#if defined(KAHYPAR_ENABLE_PERF_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define KAHYPAR_HAS_PERF_COUNTERS
+#endif
+
+#include "kahypar/macros.h"
+
+namespace kahypar {
+enum class PerfRegion : uint8_t {
+  coarsening,
+  initial_partitioning,
+  local_search,
+  rating,
+  contraction,
+  uncontraction,
+  fm_moves,
+  flow,
+  COUNT
+};
+
+static std::ostream& operator<< (std::ostream& os, const PerfRegion& region) {
+  switch (region) {
+    case PerfRegion::coarsening: return os << "coarsening";
+    case PerfRegion::initial_partitioning: return os << "initial_partitioning";
+    case PerfRegion::local_search: return os << "local_search";
+    case PerfRegion::rating: return os << "rating";
+    case PerfRegion::contraction: return os << "contraction";
+    case PerfRegion::uncontraction: return os << "uncontraction";
+    case PerfRegion::fm_moves: return os << "fm_moves";
+    case PerfRegion::flow: return os << "flow";
+    case PerfRegion::COUNT: return os << "";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(region);
+}
+
+struct PerfCounterValues {
+  uint64_t calls = 0;
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t llc_misses = 0;
+  uint64_t branch_misses = 0;
+};
+
+// Hardware performance counters (cycles, instructions, last level cache misses
+// and branch misses) of the calling thread, read via perf_event_open.
+// Counters are only available if KaHyPar is built with the CMake option
+// KAHYPAR_ENABLE_PERF_COUNTERS on Linux. Otherwise, isEnabled() is constant
+// false and all ScopedPerfCounters compile to nothing.
+// Note that each measurement reads the counters twice via a system call.
+// Values of fine-grained regions (e.g. rating) therefore include some
+// measurement overhead and regions are inclusive, i.e., the phase regions
+// also contain the counts of the kernels executed within them.
+class PerfCounters {
+  static constexpr size_t kNumEvents = 4;
+
+ public:
+  using Snapshot = std::array<uint64_t, kNumEvents>;
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters(PerfCounters&&) = delete;
+  PerfCounters& operator= (const PerfCounters&) = delete;
+  PerfCounters& operator= (PerfCounters&&) = delete;
+
+  // The counters measure the calling thread only.
+  static PerfCounters & instance() {
+    static thread_local PerfCounters instance;
+    return instance;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool isEnabled() const {
+#ifdef KAHYPAR_HAS_PERF_COUNTERS
+    return _enabled;
+#else
+    return false;
+#endif
+  }
+
+  // Opens the counters and resets all recorded values. Returns false if
+  // counters are not supported by the build, the kernel or the hardware.
+  bool enable() {
+    clear();
+#ifdef KAHYPAR_HAS_PERF_COUNTERS
+    if (_enabled) {
+      return true;
+    }
+    const std::array<uint64_t, kNumEvents> events = { PERF_COUNT_HW_CPU_CYCLES,
+                                                      PERF_COUNT_HW_INSTRUCTIONS,
+                                                      PERF_COUNT_HW_CACHE_MISSES,
+                                                      PERF_COUNT_HW_BRANCH_MISSES };
+    for (size_t i = 0; i < kNumEvents; ++i) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(perf_event_attr));
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(perf_event_attr);
+      attr.config = events[i];
+      attr.disabled = i == 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      _fds[i] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1,
+                                         i == 0 ? -1 : _fds[0], 0));
+      if (_fds[i] == -1) {
+        closeCounters();
+        return false;
+      }
+    }
+    ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    _enabled = true;
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Closes the counters. Values recorded so far are kept.
+  void disable() {
+#ifdef KAHYPAR_HAS_PERF_COUNTERS
+    closeCounters();
+#endif
+  }
+
+  Snapshot read() const {
+    Snapshot snapshot = { };
+#ifdef KAHYPAR_HAS_PERF_COUNTERS
+    // PERF_FORMAT_GROUP: number of events followed by one value per event
+    std::array<uint64_t, kNumEvents + 1> buffer = { };
+    if (::read(_fds[0], buffer.data(), sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer))) {
+      for (size_t i = 0; i < kNumEvents; ++i) {
+        snapshot[i] = buffer[i + 1];
+      }
+    }
+#endif
+    return snapshot;
+  }
+
+  void add(const PerfRegion& region, const Snapshot& start, const Snapshot& end) {
+    PerfCounterValues& values = _values[static_cast<size_t>(region)];
+    ++values.calls;
+    values.cycles += end[0] - start[0];
+    values.instructions += end[1] - start[1];
+    values.llc_misses += end[2] - start[2];
+    values.branch_misses += end[3] - start[3];
+  }
+
+  const PerfCounterValues & values(const PerfRegion& region) const {
+    return _values[static_cast<size_t>(region)];
+  }
+
+  void clear() {
+    _values = { };
+  }
+
+ private:
+  PerfCounters() :
+    _enabled(false),
+    _fds(),
+    _values() {
+    _fds.fill(-1);
+  }
+
+  ~PerfCounters() {
+#ifdef KAHYPAR_HAS_PERF_COUNTERS
+    closeCounters();
+#endif
+  }
+
+#ifdef KAHYPAR_HAS_PERF_COUNTERS
+  void closeCounters() {
+    for (int& fd : _fds) {
+      if (fd != -1) {
+        close(fd);
+        fd = -1;
+      }
+    }
+    _enabled = false;
+  }
+#endif
+
+  bool _enabled;
+  std::array<int, kNumEvents> _fds;
+  std::array<PerfCounterValues, static_cast<size_t>(PerfRegion::COUNT)> _values;
+};
+
+// Adds the counter values between construction and destruction (or stop())
+// to the given region, if performance counters are enabled.
+class ScopedPerfCounter {
+ public:
+  explicit ScopedPerfCounter(const PerfRegion& region, const bool active = true) :
+    _region(region),
+    _enabled(active && PerfCounters::instance().isEnabled()),
+    _start() {
+    if (unlikely(_enabled)) {
+      _start = PerfCounters::instance().read();
+    }
+  }
+
+  ScopedPerfCounter(const ScopedPerfCounter&) = delete;
+  ScopedPerfCounter(ScopedPerfCounter&&) = delete;
+  ScopedPerfCounter& operator= (const ScopedPerfCounter&) = delete;
+  ScopedPerfCounter& operator= (ScopedPerfCounter&&) = delete;
+
+  ~ScopedPerfCounter() {
+    stop();
+  }
+
+  void stop() {
+    if (unlikely(_enabled)) {
+      PerfCounters::instance().add(_region, _start, PerfCounters::instance().read());
+      _enabled = false;
+    }
+  }
+
+ private:
+  const PerfRegion _region;
+  bool _enabled;
+  PerfCounters::Snapshot _start;
+};
+}  // namespace kahypar
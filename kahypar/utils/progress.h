@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+namespace progress {
+// Cancellation is cooperative: once requested, the remaining uncoarsening is
+// performed as partition projection only (see time_limit.h) and no further
+// V-cycles, repetitions or evolutionary iterations are started. Thus, a
+// cancelled partitioning call still returns a complete partition.
+//
+// Each context has its own flag. A request issued before a partitioning call
+// starts is kept and takes effect as soon as the call starts. The flag is only
+// reset when the call finishes. During the call, the flag is shared with all
+// sub-contexts copied from the context, whereas copies made by the caller get
+// their own flag (see Context). Thus, copies of a context can be used for
+// concurrent partitioning calls that are cancelled independently.
+static inline void beginPartitioningCall(Context& context) {
+  context.partition.in_partitioning_call = true;
+}
+
+static inline void endPartitioningCall(Context& context) {
+  context.partition.in_partitioning_call = false;
+  context.partition.cancellation_requested->store(false, std::memory_order_relaxed);
+}
+
+// Can be called from any thread at any time.
+static inline void requestCancellation(const Context& context) {
+  context.partition.cancellation_requested->store(true, std::memory_order_relaxed);
+}
+
+static inline bool isCancellationRequested(const Context& context) {
+  return context.partition.cancellation_requested->load(std::memory_order_relaxed);
+}
+
+// Progress is only reported for the main context, i.e., not for the
+// multilevel recursive bisection used for initial partitioning.
+static inline void report(const Context& context, const ProgressPhase phase,
+                          const size_t level, const HypernodeID num_nodes,
+                          const HyperedgeWeight objective) {
+  if (context.type == ContextType::main && context.partition.progress_callback &&
+      context.partition.progress_callback({ phase, level, num_nodes, objective })) {
+    requestCancellation(context);
+  }
+}
+}  // namespace progress
+}  // namespace kahypar
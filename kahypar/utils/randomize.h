@@ -34,8 +34,10 @@ class Randomize {
   Randomize& operator= (const Randomize&) = delete;
   Randomize& operator= (Randomize&&) = delete;
 
+  // Thread-local to make concurrent partitioning calls independent of each
+  // other and reproducible for a given seed.
   static Randomize & instance() {
-    static Randomize instance;
+    static thread_local Randomize instance;
     return instance;
   }
 
@@ -25,25 +25,51 @@
 #include "kahypar/definitions.h"
 #include "kahypar/partition/coarsening/coarsening_memento.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/utils/progress.h"
 
 namespace kahypar {
 namespace time_limit {
+static inline double elapsedSeconds(const Context& context) {
+  const HighResClockTimepoint now = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(now - context.partition.start_time).count();
+}
+
+// Deadline check that is cheap enough to be polled by all phases of the
+// multilevel pipeline. Once the time limit is exceeded (or cancellation is
+// requested), each phase degrades gracefully: preprocessing and coarsening
+// stop early, initial partitioning performs only a single run, flow-based
+// refinement is skipped and the remaining uncoarsening only projects the
+// partition. The phases that were cut short are reported in the RESULT line.
+// Evolutionary and time-limited repeated partitioning use the time limit as
+// total budget for complete partitioning calls. Thus, only cancellation cuts
+// their partitioning calls short.
+static inline bool isTimeLimitExceeded(const Context& context, const TimeLimitPhase phase) {
+  const bool cancelled = progress::isCancellationRequested(context);
+  if (!cancelled && (context.partition_evolutionary ||
+                     context.partition.time_limited_repeated_partitioning)) {
+    return false;
+  }
+  const bool exceeded = cancelled ||
+                        (context.partition.time_limit > 0 &&
+                         elapsedSeconds(context) >= context.partition.time_limit *
+                         context.partition.soft_time_limit_factor);
+  if (exceeded) {
+    context.partition.time_limit_triggered = true;
+    (*context.partition.time_limited_phases)[static_cast<size_t>(phase)] = true;
+  }
+  return exceeded;
+}
+
 bool isSoftTimeLimitExceeded(const Context& context, const size_t history_size) {
-  if (context.partition_evolutionary ||
-      context.partition.time_limited_repeated_partitioning ||
-      context.partition.time_limit <= 0 ||
+  // Cancellation is checked for each uncontraction, the clock is only
+  // read every soft_time_limit_check_frequency uncontractions.
+  if (!progress::isCancellationRequested(context) &&
       history_size % context.partition.soft_time_limit_check_frequency != 0) {
     return false;
   }
-  const HighResClockTimepoint now = std::chrono::high_resolution_clock::now();
-  const auto duration = std::chrono::duration<double>(now - context.partition.start_time);
-  const bool result = duration.count() >= context.partition.time_limit *
-                      context.partition.soft_time_limit_factor;
-  if (result) {
-    context.partition.time_limit_triggered = true;
-    if (context.partition.verbose_output) {
-      LOG << "Time limit triggered after" << duration.count() << "seconds. " << history_size << "uncontractions left. Cancel refinement.";
-    }
+  const bool result = isTimeLimitExceeded(context, TimeLimitPhase::local_search);
+  if (result && context.partition.verbose_output) {
+    LOG << "Time limit triggered after" << elapsedSeconds(context) << "seconds. " << history_size << "uncontractions left. Cancel refinement.";
   }
   return result;
 }
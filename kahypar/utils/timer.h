@@ -28,6 +28,7 @@
 
 namespace kahypar {
 enum class Timepoint : uint8_t {
+  pre_node_reordering,
   pre_sparsifier,
   pre_community_detection,
   coarsening,
@@ -40,6 +41,7 @@ enum class Timepoint : uint8_t {
   v_cycle_coarsening,
   v_cycle_local_search,
   post_sparsifier_restore,
+  post_node_reordering_restore,
   evolutionary,
   COUNT
 };
@@ -82,6 +84,7 @@ class Timer {
 
 
   struct Result {
+    double pre_node_reordering = 0.0;
     double pre_sparsifier = 0.0;
     double pre_community_detection = 0.0;
     double total_preprocessing = 0.0;
@@ -96,6 +99,7 @@ class Timer {
     double total_v_cycle_local_search = 0.0;
     double total_postprocessing = 0.0;
     double post_sparsifier_restore = 0.0;
+    double post_node_reordering_restore = 0.0;
     double total_evolutionary = 0.0;
     std::vector<double> evolutionary = { };
     std::vector<double> v_cycle_coarsening = { };
@@ -110,8 +114,10 @@ class Timer {
     _timings.emplace_back(context, timepoint, time);
   }
 
+  // Each thread has its own timer, such that concurrent partitioning calls
+  // (e.g., from different Python threads) do not mix their timings.
   static Timer & instance() {
-    static Timer instance;
+    static thread_local Timer instance;
     return instance;
   }
 
@@ -161,6 +167,9 @@ class Timer {
 
       if (timing.type == ContextType::main) {
         switch (timing.timepoint) {
+          case Timepoint::pre_node_reordering:
+            _result.pre_node_reordering = timing.time;
+            break;
           case Timepoint::pre_sparsifier:
             _result.pre_sparsifier = timing.time;
             break;
@@ -169,6 +178,10 @@ class Timer {
             break;
           case Timepoint::post_sparsifier_restore:
             _result.post_sparsifier_restore = timing.time;
+            break;
+          case Timepoint::post_node_reordering_restore:
+            _result.post_node_reordering_restore = timing.time;
+            break;
           default:
             break;
         }
@@ -242,9 +255,11 @@ class Timer {
         }
       }
     }
-    _result.total_preprocessing = _result.pre_sparsifier +
+    _result.total_preprocessing = _result.pre_node_reordering +
+                                  _result.pre_sparsifier +
                                   _result.pre_community_detection;
-    _result.total_postprocessing = _result.post_sparsifier_restore;
+    _result.total_postprocessing = _result.post_sparsifier_restore +
+                                   _result.post_node_reordering_restore;
   }
 
   Timepoint _current_timing;
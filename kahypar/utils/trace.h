@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+
+namespace kahypar {
+// Records nested time spans (e.g. phases, coarsening levels, flow calls on
+// block pairs) and writes them in the Chrome trace event format, which can be
+// inspected with chrome://tracing or https://ui.perfetto.dev.
+// Tracing is disabled by default. In this case, each trace point only costs
+// a single branch on isEnabled().
+class Tracer {
+ private:
+  struct Event {
+    Event(const char* name, const char* category, const double start,
+          const double duration, std::string&& args) :
+      name(name),
+      category(category),
+      start(start),
+      duration(duration),
+      args(std::move(args)) { }
+
+    Event(const Event&) = default;
+    Event(Event&&) = default;
+    Event& operator= (const Event&) = default;
+    Event& operator= (Event&&) = default;
+    ~Event() = default;
+
+    const char* name;
+    const char* category;
+    double start;
+    double duration;
+    std::string args;
+  };
+
+ public:
+  Tracer(const Tracer&) = delete;
+  Tracer(Tracer&&) = delete;
+  Tracer& operator= (const Tracer&) = delete;
+  Tracer& operator= (Tracer&&) = delete;
+
+  // One trace per thread, i.e., per concurrent partitioning call.
+  static Tracer & instance() {
+    static thread_local Tracer instance;
+    return instance;
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool isEnabled() const {
+    return _enabled;
+  }
+
+  void enable() {
+    _enabled = true;
+    _origin = std::chrono::high_resolution_clock::now();
+    _events.clear();
+  }
+
+  void disable() {
+    _enabled = false;
+  }
+
+  size_t numEvents() const {
+    return _events.size();
+  }
+
+  // Name and category have to be string literals. Args has to be a
+  // (possibly empty) comma-separated list of JSON key-value pairs.
+  void add(const char* name, const char* category, const HighResClockTimepoint& start,
+           const HighResClockTimepoint& end, std::string&& args = "") {
+    _events.emplace_back(name, category,
+                         std::chrono::duration<double, std::micro>(start - _origin).count(),
+                         std::chrono::duration<double, std::micro>(end - start).count(),
+                         std::move(args));
+  }
+
+  void writeChromeTrace(const std::string& filename) const {
+    std::ofstream out(filename.c_str());
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    out << std::fixed;
+    out.precision(3);
+    for (size_t i = 0; i < _events.size(); ++i) {
+      const Event& event = _events[i];
+      out << (i == 0 ? "\n" : ",\n")
+          << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category
+          << "\",\"ph\":\"X\",\"pid\":0,\"tid\":0"
+          << ",\"ts\":" << event.start << ",\"dur\":" << event.duration
+          << ",\"args\":{" << event.args << "}}";
+    }
+    out << "\n]}" << std::endl;
+  }
+
+ private:
+  Tracer() :
+    _enabled(false),
+    _origin(),
+    _events() { }
+
+  ~Tracer() = default;
+
+  bool _enabled;
+  HighResClockTimepoint _origin;
+  std::vector<Event> _events;
+};
+
+// Appends key-value pairs to the args of a trace event.
+class TraceArgs {
+ public:
+  TraceArgs() :
+    _args() { }
+
+  template <typename T>
+  TraceArgs& add(const char* key, const T& value) {
+    _args += _args.empty() ? "\"" : ",\"";
+    _args += key;
+    _args += "\":";
+    if constexpr (std::is_same<T, bool>::value) {
+      _args += value ? "true" : "false";
+    } else if constexpr (std::is_arithmetic<T>::value) {
+      _args += std::to_string(value);
+    } else {
+      std::ostringstream oss;
+      oss << value;
+      _args += '"';
+      for (const char c : oss.str()) {
+        if (c == '"' || c == '\\') {
+          _args += '\\';
+        }
+        _args += c;
+      }
+      _args += '"';
+    }
+    return *this;
+  }
+
+  std::string&& release() {
+    return std::move(_args);
+  }
+
+ private:
+  std::string _args;
+};
+
+// Records the time span between construction and destruction (or stop())
+// as a trace event, if tracing is enabled.
+class ScopedTrace {
+ public:
+  ScopedTrace(const char* name, const char* category) :
+    _name(name),
+    _category(category),
+    _enabled(Tracer::instance().isEnabled()),
+    _start(),
+    _args() {
+    if (unlikely(_enabled)) {
+      _start = std::chrono::high_resolution_clock::now();
+    }
+  }
+
+  ScopedTrace(const ScopedTrace&) = delete;
+  ScopedTrace(ScopedTrace&&) = delete;
+  ScopedTrace& operator= (const ScopedTrace&) = delete;
+  ScopedTrace& operator= (ScopedTrace&&) = delete;
+
+  ~ScopedTrace() {
+    stop();
+  }
+
+  template <typename T>
+  ScopedTrace& arg(const char* key, const T& value) {
+    if (unlikely(_enabled)) {
+      _args.add(key, value);
+    }
+    return *this;
+  }
+
+  void stop() {
+    if (unlikely(_enabled)) {
+      Tracer::instance().add(_name, _category, _start,
+                             std::chrono::high_resolution_clock::now(), _args.release());
+      _enabled = false;
+    }
+  }
+
+ private:
+  const char* _name;
+  const char* _category;
+  bool _enabled;
+  HighResClockTimepoint _start;
+  TraceArgs _args;
+};
+}  // namespace kahypar
@@ -25,6 +25,7 @@
 #include "kahypar/macros.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partitioner_facade.h"
+#include "kahypar/utils/progress.h"
 #include "kahypar/utils/randomize.h"
 
 
@@ -66,6 +67,40 @@ void kahypar_configure_context_from_file(kahypar_context_t* kahypar_context,
                              ini_file_name);
 }
 
+void kahypar_set_improved_solution_callback(kahypar_context_t* kahypar_context,
+                                            kahypar_improved_solution_callback_t callback,
+                                            void* user_data) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  if (callback == nullptr) {
+    context.partition.improved_solution_callback = nullptr;
+    return;
+  }
+  context.partition.improved_solution_callback =
+    [callback, user_data](const std::vector<kahypar::PartitionID>& partition,
+                          const kahypar::HyperedgeWeight objective, const double imbalance) {
+      callback(partition.data(), objective, imbalance, user_data);
+    };
+}
+
+void kahypar_set_progress_callback(kahypar_context_t* kahypar_context,
+                                   kahypar_progress_callback_t callback,
+                                   void* user_data) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  if (callback == nullptr) {
+    context.partition.progress_callback = nullptr;
+    return;
+  }
+  context.partition.progress_callback =
+    [callback, user_data](const kahypar::PartitioningProgress& progress) {
+      return callback(static_cast<kahypar_progress_phase_t>(progress.phase), progress.level,
+                      progress.num_nodes, progress.objective, user_data) != 0;
+    };
+}
+
+void kahypar_cancel_partitioning(kahypar_context_t* kahypar_context) {
+  kahypar::progress::requestCancellation(*reinterpret_cast<kahypar::Context*>(kahypar_context));
+}
+
 void kahypar_set_fixed_vertices(kahypar_hypergraph_t* kahypar_hypergraph,
                                 const kahypar_partition_id_t* fixed_vertex_blocks) {
   kahypar::Hypergraph& hypergraph = *reinterpret_cast<kahypar::Hypergraph*>(kahypar_hypergraph);
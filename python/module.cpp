@@ -21,8 +21,11 @@
 
 #include <pybind11/pybind11.h>
 
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -34,18 +37,70 @@
 #include "kahypar/application/command_line_options.h"
 #include "kahypar/datastructure/connectivity_sets.h"
 #include "kahypar/partition/metrics.h"
+#include "kahypar/utils/progress.h"
 
 void hello(const std::string& input) {
   std::cout << input << std::endl;
 }
 
+namespace py = pybind11;
+
 void partition(kahypar::Hypergraph& hypergraph,
                kahypar::Context& context) {
+  // Partitioning does not touch Python objects (callbacks re-acquire the GIL).
+  // Thus, other Python threads can run or partition other hypergraphs meanwhile.
+  py::gil_scoped_release release;
   kahypar::PartitionerFacade().partition(hypergraph, context);
 }
 
+// Contexts are copied during partitioning while the GIL is released. Python
+// objects stored in a context are therefore shared via a shared_ptr, which
+// can be copied without the GIL. The object itself is released with the GIL.
+std::shared_ptr<py::object> shareWithoutGIL(const py::object& object) {
+  return std::shared_ptr<py::object>(new py::object(object), [](py::object* obj) {
+      py::gil_scoped_acquire acquire;
+      delete obj;
+    });
+}
+
+// NumPy arrays are accessed through the buffer protocol. An array is only copied
+// (by NumPy) if it is not C-contiguous or does not have the required dtype.
+template <typename T>
+using NumpyArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
 
-namespace py = pybind11;
+template <typename T>
+NumpyArray<T> toNumpyArray(const py::array& array, const std::size_t expected_size,
+                           const char* name) {
+  NumpyArray<T> result = NumpyArray<T>::ensure(array);
+  if (!result || result.ndim() != 1 ||
+      static_cast<std::size_t>(result.shape(0)) != expected_size) {
+    throw py::value_error(std::string(name) + " has to be a one-dimensional array of size " +
+                          std::to_string(expected_size));
+  }
+  return result;
+}
+
+kahypar::Hypergraph createHypergraphFromArrays(const kahypar::HypernodeID num_nodes,
+                                               const kahypar::HyperedgeID num_edges,
+                                               const py::array& index_array,
+                                               const py::array& edge_array,
+                                               const kahypar::PartitionID k,
+                                               const py::array& edge_weight_array,
+                                               const py::array& node_weight_array) {
+  const auto index_vector = toNumpyArray<size_t>(index_array, num_edges + 1, "index_vector");
+  const auto edge_vector = toNumpyArray<kahypar::HypernodeID>(
+    edge_array, index_vector.at(num_edges), "edge_vector");
+  // Empty weight arrays denote unit weights.
+  const bool has_edge_weights = edge_weight_array.size() > 0;
+  const bool has_node_weights = node_weight_array.size() > 0;
+  const auto edge_weights = toNumpyArray<kahypar::HyperedgeWeight>(
+    edge_weight_array, has_edge_weights ? num_edges : 0, "edge_weights");
+  const auto node_weights = toNumpyArray<kahypar::HypernodeWeight>(
+    node_weight_array, has_node_weights ? num_nodes : 0, "node_weights");
+  return kahypar::Hypergraph(num_nodes, num_edges, index_vector.data(), edge_vector.data(), k,
+                             has_edge_weights ? edge_weights.data() : nullptr,
+                             has_node_weights ? node_weights.data() : nullptr);
+}
 
 PYBIND11_MODULE(kahypar, m) {
   using kahypar::Hypergraph;
@@ -60,6 +115,54 @@ PYBIND11_MODULE(kahypar, m) {
 
   py::class_<Hypergraph>(
       m, "Hypergraph")
+      // The NumPy overloads have to be registered first. Otherwise, NumPy arrays
+      // would be converted element by element by the std::vector overloads.
+      .def(py::init([](const HypernodeID num_nodes, const HyperedgeID num_edges,
+                       const py::array& index_vector, const py::array& edge_vector,
+                       const PartitionID k) {
+             return createHypergraphFromArrays(num_nodes, num_edges, index_vector, edge_vector, k,
+                                               py::array(), py::array());
+           }), R"pbdoc(
+Construct an unweighted hypergraph from NumPy arrays.
+
+Arrays that are C-contiguous and of dtype uint64 (index_vector) and uint32
+(edge_vector) are read without being copied.
+
+:param HypernodeID num_nodes: Number of nodes
+:param HyperedgeID num_edges: Number of hyperedges
+:param numpy.ndarray index_vector: Starting indices for each hyperedge
+:param numpy.ndarray edge_vector: Array containing all hyperedges
+:param PartitionID k: Number of blocks in which the hypergraph should be partitioned
+
+          )pbdoc",
+           py::arg("num_nodes"),
+           py::arg("num_edges"),
+           py::arg("index_vector"),
+           py::arg("edge_vector"),
+           py::arg("k"))
+      .def(py::init(&createHypergraphFromArrays), R"pbdoc(
+Construct a hypergraph with node and edge weights from NumPy arrays.
+
+If only one type of weights is required, the other argument has to be an empty array.
+Arrays that are C-contiguous and of dtype uint64 (index_vector), uint32 (edge_vector)
+and int32 (weights) are read without being copied.
+
+:param HypernodeID num_nodes: Number of nodes
+:param HyperedgeID num_edges: Number of hyperedges
+:param numpy.ndarray index_vector: Starting indices for each hyperedge
+:param numpy.ndarray edge_vector: Array containing all hyperedges
+:param PartitionID k: Number of blocks in which the hypergraph should be partitioned
+:param numpy.ndarray edge_weights: Weights of all hyperedges
+:param numpy.ndarray node_weights: Weights of all hypernodes
+
+          )pbdoc",
+           py::arg("num_nodes"),
+           py::arg("num_edges"),
+           py::arg("index_vector"),
+           py::arg("edge_vector"),
+           py::arg("k"),
+           py::arg("edge_weights"),
+           py::arg("node_weights"))
       .def(py::init<const HypernodeID,
            const HyperedgeID,
            const HyperedgeIndexVector,
@@ -123,6 +226,15 @@ If only one type of weights is required, the other argument has to be an empty l
       .def("blockID", &Hypergraph::partID,
            "Get the block of the node in the current hypergraph partition (before partitioning: -1)",
            py::arg("node"))
+      .def("blockIDs", [](const Hypergraph& h) {
+          py::array_t<PartitionID> block_ids(h.initialNumNodes());
+          PartitionID* data = block_ids.mutable_data();
+          for (HypernodeID hn = 0; hn < h.initialNumNodes(); ++hn) {
+            data[hn] = h.partID(hn);
+          }
+          return block_ids;
+        },
+           "Get the blocks of all nodes as NumPy array (before partitioning: -1)")
       .def("numNodes", &Hypergraph::initialNumNodes,
            "Get the number of nodes")
       .def("numEdges", &Hypergraph::initialNumEdges,
@@ -196,9 +308,24 @@ If only one type of weights is required, the other argument has to be an empty l
 
   m.def(
       "partition", &partition,
-      "Compute a k-way partition of the hypergraph",
+      "Compute a k-way partition of the hypergraph. The GIL is released during partitioning, "
+      "i.e., distinct hypergraphs can be partitioned concurrently from different threads "
+      "using distinct contexts.",
       py::arg("hypergraph"), py::arg("context"));
 
+  m.def(
+      "partitionAsync",
+      [partition_function = py::object(m.attr("partition"))](const py::object& hypergraph,
+                                                             const py::object& context,
+                                                             const py::object& executor) {
+        const py::object loop = py::module::import("asyncio").attr("get_running_loop")();
+        return loop.attr("run_in_executor")(executor, partition_function, hypergraph, context);
+      },
+      "Compute a k-way partition of the hypergraph in a thread of the executor (default: "
+      "the default executor of the running event loop). Has to be called from a coroutine "
+      "and returns an awaitable asyncio future.",
+      py::arg("hypergraph"), py::arg("context"), py::arg("executor") = py::none());
+
   m.def(
       "cut", &kahypar::metrics::hyperedgeCut,
       "Compute the cut-net metric for the partitioned hypergraph",
@@ -254,6 +381,52 @@ If only one type of weights is required, the other argument has to be an empty l
         },
         "Suppress partitioning output",
         py::arg("bool"))
+      .def("setImprovedSolutionCallback",
+           [](Context& c, const py::object& callback) {
+             if (callback.is_none()) {
+               c.partition.improved_solution_callback = nullptr;
+               return;
+             }
+             const std::shared_ptr<py::object> shared_callback = shareWithoutGIL(callback);
+             c.partition.improved_solution_callback =
+               [shared_callback](const std::vector<PartitionID>& partition,
+                                 const kahypar::HyperedgeWeight objective,
+                                 const double imbalance) {
+                 py::gil_scoped_acquire acquire;
+                 (*shared_callback)(partition, objective, imbalance);
+               };
+           },
+           "Function called with the partition, the objective and the imbalance of each "
+           "improving solution found during partitioning. Pass None to remove the callback.",
+           py::arg("callback"))
+      .def("setProgressCallback",
+           [](Context& c, const py::object& callback) {
+             if (callback.is_none()) {
+               c.partition.progress_callback = nullptr;
+               return;
+             }
+             const std::shared_ptr<py::object> shared_callback = shareWithoutGIL(callback);
+             c.partition.progress_callback =
+               [shared_callback](const kahypar::PartitioningProgress& progress) {
+                 std::ostringstream phase;
+                 phase << progress.phase;
+                 py::gil_scoped_acquire acquire;
+                 const py::object cancel = (*shared_callback)(phase.str(), progress.level,
+                                                              progress.num_nodes,
+                                                              progress.objective);
+                 return !cancel.is_none() && cancel.cast<bool>();
+               };
+           },
+           "Function called periodically with the current phase ('coarsening', "
+           "'initial_partitioning' or 'uncoarsening'), level, number of nodes and objective. "
+           "Returning True cancels partitioning. Pass None to remove the callback.",
+           py::arg("callback"))
+      .def("cancel",
+           [](const Context& c) {
+             kahypar::progress::requestCancellation(c);
+           },
+           "Request cancellation of the partitioning call that currently uses this context. "
+           "If no call uses the context, the next call using it is cancelled. The call returns as soon as possible with a complete, but possibly low-quality partition.")
       .def("loadINIconfiguration",
            [](Context& c, const std::string& path) {
              parseIniToContext(c, path);
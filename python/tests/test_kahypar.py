@@ -18,11 +18,18 @@
 # *
 # ******************************************************************************/
 
+import asyncio
+import threading
 import unittest
 import os
 
 import kahypar as kahypar
 
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
 mydir = os.path.dirname(os.path.realpath(__file__))
 
 class MainTest(unittest.TestCase):
@@ -96,5 +103,116 @@ class MainTest(unittest.TestCase):
         self.assertEqual(kahypar.connectivityMinusOne(ibm01), 202)
         self.assertEqual(kahypar.imbalance(ibm01,context), 0.027603513174403904)
 
+    def test_reports_improving_solutions_via_callback(self):
+        context = kahypar.Context()
+        context.loadINIconfiguration(mydir+"/../..//config/km1_kKaHyPar_dissertation.ini")
+
+        ibm01 = kahypar.createHypergraphFromFile(mydir+"/ISPD98_ibm01.hgr",2)
+
+        context.setK(2)
+        context.setEpsilon(0.03)
+        solutions = []
+        context.setImprovedSolutionCallback(
+            lambda partition, objective, imbalance: solutions.append((list(partition), objective)))
+        kahypar.partition(ibm01, context)
+
+        self.assertGreater(len(solutions), 0)
+        best_partition, best_objective = solutions[-1]
+        self.assertEqual(best_objective, kahypar.connectivityMinusOne(ibm01))
+        self.assertEqual(best_partition, [ibm01.blockID(hn) for hn in ibm01.nodes()])
+        self.assertTrue(all(objective >= best_objective for _, objective in solutions))
+
+    def test_cancels_partitioning_via_progress_callback(self):
+        context = kahypar.Context()
+        context.loadINIconfiguration(mydir+"/../..//config/km1_kKaHyPar_dissertation.ini")
+
+        ibm01 = kahypar.createHypergraphFromFile(mydir+"/ISPD98_ibm01.hgr",2)
+
+        context.setK(2)
+        context.setEpsilon(0.03)
+        phases = []
+        def cancel_during_uncoarsening(phase, level, num_nodes, objective):
+            phases.append(phase)
+            return phase == "uncoarsening"
+        context.setProgressCallback(cancel_during_uncoarsening)
+        kahypar.partition(ibm01, context)
+
+        self.assertIn("coarsening", phases)
+        self.assertEqual(phases.count("uncoarsening"), 1)
+        self.assertTrue(all(0 <= ibm01.blockID(hn) < 2 for hn in ibm01.nodes()))
+
+    def partition_ibm01(self, k, seed):
+        context = kahypar.Context()
+        context.loadINIconfiguration(mydir+"/../..//config/km1_kKaHyPar_dissertation.ini")
+        context.setK(k)
+        context.setEpsilon(0.03)
+        context.setSeed(seed)
+        context.suppressOutput(True)
+        return kahypar.createHypergraphFromFile(mydir+"/ISPD98_ibm01.hgr",k), context
+
+    def test_partitions_hypergraphs_concurrently(self):
+        instances = [self.partition_ibm01(k, seed) for k, seed in [(2, 1), (4, 2), (8, 3)]]
+        threads = [threading.Thread(target=kahypar.partition, args=instance)
+                   for instance in instances]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        # Concurrent calls do not share state: each result equals the sequential one.
+        for (hypergraph, _), (k, seed) in zip(instances, [(2, 1), (4, 2), (8, 3)]):
+            sequential, context = self.partition_ibm01(k, seed)
+            kahypar.partition(sequential, context)
+            self.assertEqual([hypergraph.blockID(hn) for hn in hypergraph.nodes()],
+                             [sequential.blockID(hn) for hn in sequential.nodes()])
+
+    def test_partitions_hypergraph_asynchronously(self):
+        instances = [self.partition_ibm01(2, seed) for seed in [1, 2]]
+
+        async def partition_all():
+            await asyncio.gather(*[kahypar.partitionAsync(hypergraph, context)
+                                   for hypergraph, context in instances])
+
+        asyncio.run(partition_all())
+        for hypergraph, _ in instances:
+            self.assertTrue(all(0 <= hypergraph.blockID(hn) < 2 for hn in hypergraph.nodes()))
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_construct_hypergraph_from_numpy_arrays(self):
+        hyperedge_indices = np.array([0,2,6,9,12], dtype=np.uint64)
+        hyperedges = np.array([0,2,0,1,3,4,3,4,6,2,5,6], dtype=np.uint32)
+        node_weights = np.arange(1, 8, dtype=np.int32)
+        edge_weights = np.array([11,22,33,44])  # int64, converted by NumPy
+
+        hypergraph = kahypar.Hypergraph(7, 4, hyperedge_indices, hyperedges, 2,
+                                        edge_weights, node_weights)
+
+        self.assertEqual(hypergraph.numPins(),12)
+        self.assertEqual(hypergraph.nodeWeight(6),7)
+        self.assertEqual(hypergraph.edgeWeight(3),44)
+        self.assertEqual(list(hypergraph.pins(1)),[0,1,3,4])
+
+        unweighted = kahypar.Hypergraph(7, 4, hyperedge_indices, hyperedges, 2,
+                                        np.array([]), node_weights)
+        self.assertEqual(unweighted.edgeWeight(3),1)
+
+        with self.assertRaises(ValueError):
+            kahypar.Hypergraph(7, 4, hyperedge_indices[:-1], hyperedges, 2)
+
+    @unittest.skipIf(np is None, "NumPy is not installed")
+    def test_returns_partition_as_numpy_array(self):
+        context = kahypar.Context()
+        context.loadINIconfiguration(mydir+"/../..//config/km1_kKaHyPar_dissertation.ini")
+        context.setK(2)
+        context.setEpsilon(0.03)
+
+        ibm01 = kahypar.createHypergraphFromFile(mydir+"/ISPD98_ibm01.hgr",2)
+        kahypar.partition(ibm01, context)
+
+        block_ids = ibm01.blockIDs()
+        self.assertEqual(block_ids.dtype, np.int32)
+        self.assertEqual(len(block_ids), ibm01.numNodes())
+        self.assertEqual(block_ids.tolist(), [ibm01.blockID(hn) for hn in ibm01.nodes()])
+
 if __name__ == '__main__':
     unittest.main()
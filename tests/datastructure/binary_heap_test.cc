@@ -18,6 +18,9 @@
  *
  ******************************************************************************/
 
+#include <random>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 #include "kahypar/datastructure/binary_heap.h"
@@ -56,7 +59,11 @@ class AMinHeap : public Test {
   MinHeapType _heap;
 };
 
-typedef ::testing::Types<MaxHeapType, MinHeapType> Implementations;
+typedef ::testing::Types<MaxHeapType, MinHeapType,
+                         DaryMaxHeap<HypernodeID, HyperedgeWeight, 4>,
+                         DaryMinHeap<HypernodeID, HyperedgeWeight, 4>,
+                         DaryMaxHeap<HypernodeID, HyperedgeWeight, 8>,
+                         DaryMinHeap<HypernodeID, HyperedgeWeight, 8> > Implementations;
 
 TYPED_TEST_CASE(AHeap, Implementations);
 
@@ -74,6 +81,65 @@ TYPED_TEST(AHeap, HasSizeOneAfterOneInsertion) {
   ASSERT_EQ(this->_heap.size(), 1);
 }
 
+TYPED_TEST(AHeap, AlwaysReturnsTheElementWithTheHighestPriority) {
+  using HeapType = typename TestFixture::HeapType;
+  const HypernodeID num_elements = 500;
+  typename HeapType::Comparator compare;
+  HeapType heap(num_elements);
+  std::vector<HyperedgeWeight> keys(num_elements, 0);
+  std::vector<bool> contained(num_elements, false);
+  size_t size = 0;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<HypernodeID> id_dist(0, num_elements - 1);
+  std::uniform_int_distribution<HyperedgeWeight> key_dist(-100, 100);
+
+  for (size_t i = 0; i < 50000; ++i) {
+    const HypernodeID id = id_dist(gen);
+    const HyperedgeWeight key = key_dist(gen);
+    switch (gen() % 4) {
+      case 0:
+        if (contained[id]) {
+          heap.updateKey(id, key);
+        } else {
+          heap.push(id, key);
+          contained[id] = true;
+          ++size;
+        }
+        keys[id] = key;
+        break;
+      case 1:
+        if (contained[id]) {
+          heap.remove(id);
+          contained[id] = false;
+          --size;
+        }
+        break;
+      case 2:
+        if (!heap.empty()) {
+          contained[heap.top()] = false;
+          heap.pop();
+          --size;
+        }
+        break;
+      default:
+        if (contained[id]) {
+          heap.updateKeyBy(id, key);
+          keys[id] += key;
+        }
+    }
+
+    ASSERT_EQ(heap.size(), size);
+    if (size > 0) {
+      ASSERT_TRUE(contained[heap.top()]);
+      ASSERT_EQ(heap.topKey(), keys[heap.top()]);
+      for (HypernodeID hn = 0; hn < num_elements; ++hn) {
+        ASSERT_EQ(heap.contains(hn), contained[hn]);
+        ASSERT_TRUE(!contained[hn] || !compare(heap.topKey(), keys[hn]));
+      }
+    }
+  }
+}
+
 // Max Heap tests
 
 TEST_F(AMaxHeap, ReturnsTheMaximumElement) {
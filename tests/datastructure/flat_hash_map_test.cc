@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "kahypar/datastructure/flat_hash_map.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::DoubleEq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+class AFlatHashMap : public Test {
+ public:
+  AFlatHashMap() :
+    map(20) { }
+
+  FlatHashMap<HypernodeID, double> map;
+};
+
+TEST_F(AFlatHashMap, ReturnsTrueIfElementIsInTheMap) {
+  map.add(5, 5.5);
+  map.add(6, 6.5);
+  ASSERT_TRUE(map.contains(6));
+  ASSERT_TRUE(map.contains(5));
+  ASSERT_THAT(map.get(5), DoubleEq(5.5));
+}
+
+TEST_F(AFlatHashMap, ReturnsFalseIfElementIsNotInTheMap) {
+  map.add(6, 6.6);
+  ASSERT_FALSE(map.contains(5));
+}
+
+TEST_F(AFlatHashMap, ReturnsFalseAfterElementIsRemoved) {
+  map.add(6, 6.6);
+  map.add(1, 1.1);
+  map.add(3, 3.3);
+
+  map.remove(6);
+
+  ASSERT_FALSE(map.contains(6));
+  ASSERT_TRUE(map.contains(1));
+  ASSERT_TRUE(map.contains(3));
+  ASSERT_THAT(map.get(1), DoubleEq(1.1));
+  ASSERT_THAT(map.get(3), DoubleEq(3.3));
+  ASSERT_THAT(map.size(), Eq(2));
+}
+
+TEST_F(AFlatHashMap, AllowsIterationInInsertionOrder) {
+  std::vector<HypernodeID> v { 6, 1, 3 };
+
+  map[6] += 6.6;
+  map[1] += 1.1;
+  map[3] += 3.3;
+  map[6] += 1.0;
+
+  size_t i = 0;
+  for (const auto& element : map) {
+    ASSERT_THAT(element.key, Eq(v[i++]));
+  }
+  ASSERT_THAT(i, Eq(3));
+  ASSERT_THAT(map.get(6), DoubleEq(7.6));
+}
+
+TEST_F(AFlatHashMap, DoesNotContainElementsAfterItIsCleared) {
+  map.add(6, 6.6);
+  map.add(1, 1.1);
+  map.add(3, 3.3);
+
+  map.clear();
+
+  ASSERT_THAT(map.size(), Eq(0));
+  ASSERT_FALSE(map.contains(6));
+  ASSERT_FALSE(map.contains(1));
+  ASSERT_FALSE(map.contains(3));
+}
+
+TEST_F(AFlatHashMap, GrowsIfMoreElementsThanTheInitialCapacityAreInserted) {
+  const size_t initial_capacity = map.capacity();
+  for (HypernodeID i = 0; i < 10 * initial_capacity; ++i) {
+    map[3 * i] = i;
+  }
+  ASSERT_THAT(map.size(), Eq(10 * initial_capacity));
+  ASSERT_GT(map.capacity(), initial_capacity);
+  for (HypernodeID i = 0; i < 10 * initial_capacity; ++i) {
+    ASSERT_TRUE(map.contains(3 * i));
+    ASSERT_FALSE(map.contains(3 * i + 1));
+    ASSERT_THAT(map.get(3 * i), DoubleEq(i));
+  }
+}
+
+TEST(FlatHashMap, BehavesLikeAnUnorderedMapForRandomOperations) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<HypernodeID> key(0, 2000);
+  std::uniform_int_distribution<int> operation(0, 99);
+
+  FlatHashMap<HypernodeID, int> map(64);
+  std::unordered_map<HypernodeID, int> expected;
+  for (int i = 0; i < 100000; ++i) {
+    const HypernodeID k = key(gen);
+    const int op = operation(gen);
+    if (op < 60) {
+      map[k] += op;
+      expected[k] += op;
+    } else if (op < 90) {
+      map.remove(k);
+      expected.erase(k);
+    } else if (op < 99) {
+      ASSERT_THAT(map.contains(k), Eq(expected.count(k) > 0));
+    } else {
+      map.clear();
+      expected.clear();
+    }
+    ASSERT_THAT(map.size(), Eq(expected.size()));
+  }
+  for (const auto& element : map) {
+    ASSERT_THAT(element.value, Eq(expected[element.key]));
+  }
+}
+}  // namespace ds
+}  // namespace kahypar
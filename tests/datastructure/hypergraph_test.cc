@@ -21,6 +21,7 @@
 #include <iostream>
 #include <stack>
 #include <tuple>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -613,6 +614,53 @@ TEST(ConnectivitySets, AreCleardWhenSingleNodeHyperedgesAreRemoved) {
   ASSERT_THAT(*hypergraph.connectivitySet(0).begin(), Eq(1));
 }
 
+TEST(ConnectivitySets, UseBitsetsForAtMost64Blocks) {
+  using ConnectivitySets = ds::ConnectivitySets<PartitionID, HyperedgeID>;
+  ConnectivitySets connectivity_sets(1, 64);
+  connectivity_sets[0].add(63);
+  connectivity_sets[0].add(5);
+  connectivity_sets[0].add(0);
+  connectivity_sets[0].remove(5);
+
+  ASSERT_THAT(connectivity_sets[0].size(), Eq(2));
+  ASSERT_TRUE(connectivity_sets[0].contains(0));
+  ASSERT_TRUE(connectivity_sets[0].contains(63));
+  ASSERT_FALSE(connectivity_sets[0].contains(5));
+  ASSERT_THAT(std::vector<PartitionID>(connectivity_sets[0].begin(), connectivity_sets[0].end()),
+              ContainerEq(std::vector<PartitionID>({ 0, 63 })));
+  ASSERT_THAT(connectivity_sets.memoryConsumption(), Eq(sizeof(ConnectivitySets::ConnectivitySet)));
+}
+
+TEST(ConnectivitySets, UseArraysForMoreThan64Blocks) {
+  using ConnectivitySets = ds::ConnectivitySets<PartitionID, HyperedgeID>;
+  ConnectivitySets connectivity_sets(1, 128);
+  connectivity_sets[0].add(127);
+  connectivity_sets[0].add(64);
+  connectivity_sets[0].add(3);
+  connectivity_sets[0].remove(127);
+
+  ASSERT_THAT(connectivity_sets[0].size(), Eq(2));
+  ASSERT_TRUE(connectivity_sets[0].contains(64));
+  ASSERT_FALSE(connectivity_sets[0].contains(127));
+  ASSERT_THAT(std::vector<PartitionID>(connectivity_sets[0].begin(), connectivity_sets[0].end()),
+              ContainerEq(std::vector<PartitionID>({ 3, 64 })));
+
+  for (PartitionID part = 65; part < 128; ++part) {
+    connectivity_sets[0].add(part);
+  }
+  ASSERT_THAT(connectivity_sets[0].size(), Eq(65));
+  ASSERT_TRUE(connectivity_sets[0].contains(127));
+
+  connectivity_sets[0].clear();
+  ASSERT_THAT(connectivity_sets[0].size(), Eq(0));
+  ASSERT_TRUE(connectivity_sets[0].begin() == connectivity_sets[0].end());
+}
+
+TEST(ConnectivitySets, AreNotLargerThanAVectorOfBlocks) {
+  using ConnectivitySet = ds::ConnectivitySets<PartitionID, HyperedgeID>::ConnectivitySet;
+  ASSERT_LE(sizeof(ConnectivitySet), sizeof(std::vector<PartitionID>));
+}
+
 TEST_F(AHypergraph, MaintainsCorrectPartSizesDuringUncontraction) {
   std::stack<Memento> mementos;
   mementos.push(hypergraph.contract(0, 1));
@@ -1129,5 +1177,27 @@ TEST(Hypergraphs, CanBeStrippedOfAllIdenticalVertices) {
   ASSERT_EQ(hypergraph.edgeSize(0), 2);
   ASSERT_EQ(hypergraph.edgeSize(1), 2);
 }
+
+TEST_F(AHypergraph, AccountsForIncidenceArrayInMemoryConsumption) {
+  ASSERT_GE(hypergraph.incidenceStructureMemoryConsumption(),
+            2 * hypergraph.initialNumPins() * sizeof(HypernodeID));
+}
+
+TEST_F(AHypergraph, AccountsForConnectivitySetsInPartitionMemoryConsumption) {
+  hypergraph.changeK(128);
+  const size_t memory_before_partitioning = hypergraph.partitionMemoryConsumption();
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, hn % 2);
+  }
+  ASSERT_GT(hypergraph.partitionMemoryConsumption(), memory_before_partitioning);
+}
+
+TEST_F(AHypergraph, DoesNotAllocateConnectivitySetsForSmallK) {
+  const size_t memory_before_partitioning = hypergraph.partitionMemoryConsumption();
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, hn % 2);
+  }
+  ASSERT_THAT(hypergraph.partitionMemoryConsumption(), Eq(memory_before_partitioning));
+}
 }  // namespace ds
 }  // namespace kahypar
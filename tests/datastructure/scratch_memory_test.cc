@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/datastructure/scratch_memory.h"
+#include "kahypar/datastructure/sparse_map.h"
+#include "kahypar/datastructure/sparse_set.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+class AScratchMemory : public Test {
+ public:
+  AScratchMemory() {
+    ScratchMemory::instance().release();
+  }
+
+  ~AScratchMemory() {
+    ScratchMemory::instance().release();
+  }
+};
+
+TEST_F(AScratchMemory, ReusesMemoryOfDestroyedArrays) {
+  const uint16_t* memory = nullptr;
+  {
+    ScratchArray<uint16_t> array(100);
+    memory = array.get();
+  }
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(1));
+  ScratchArray<uint16_t> array(80);
+  ASSERT_THAT(array.get(), Eq(memory));
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(0));
+}
+
+TEST_F(AScratchMemory, DoesNotReuseMemoryOfMuchLargerArrays) {
+  {
+    ScratchArray<uint16_t> array(1000);
+  }
+  ScratchArray<uint16_t> array(100);
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(1));
+}
+
+TEST_F(AScratchMemory, DoesNotReuseRawMemoryForTimestamps) {
+  {
+    ScratchArray<uint16_t> array(100);
+  }
+  ScratchArray<uint16_t> stamps = ScratchArray<uint16_t>::stamped(100);
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(1));
+}
+
+TEST_F(AScratchMemory, FreesUnusedMemoryOnRelease) {
+  {
+    ScratchArray<uint16_t> array(100);
+    ScratchArray<uint16_t> stamps = ScratchArray<uint16_t>::stamped(100);
+  }
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(2));
+  ASSERT_THAT(ScratchMemory::instance().freeBytes(), Eq(400));
+  ScratchMemory::instance().release();
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(0));
+}
+
+TEST_F(AScratchMemory, InvalidatesTimestampsWhenLeasingAStampedArray) {
+  {
+    ScratchArray<uint16_t> stamps = ScratchArray<uint16_t>::stamped(10);
+    for (size_t i = 0; i < 10; ++i) {
+      stamps[i] = stamps.generation();
+    }
+  }
+  ScratchArray<uint16_t> stamps = ScratchArray<uint16_t>::stamped(10);
+  for (size_t i = 0; i < 10; ++i) {
+    ASSERT_LT(stamps[i], stamps.generation());
+  }
+}
+
+TEST_F(AScratchMemory, ResetsTimestampsOnGenerationOverflow) {
+  {
+    ScratchArray<uint8_t> stamps = ScratchArray<uint8_t>::stamped(10);
+    stamps.setGeneration(std::numeric_limits<uint8_t>::max());
+    stamps[3] = std::numeric_limits<uint8_t>::max();
+  }
+  ScratchArray<uint8_t> stamps = ScratchArray<uint8_t>::stamped(10);
+  ASSERT_THAT(stamps.generation(), Eq(1));
+  ASSERT_THAT(stamps[3], Eq(0));
+}
+
+TEST_F(AScratchMemory, ProvidesEmptyFlagArraysAfterReuse) {
+  {
+    FastResetFlagArray<> flags(20);
+    flags.set(3);
+    flags.set(7);
+  }
+  FastResetFlagArray<> flags(20);
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(0));
+  for (size_t i = 0; i < 20; ++i) {
+    ASSERT_FALSE(flags[i]);
+  }
+}
+
+TEST_F(AScratchMemory, ProvidesEmptyFlagArraysAfterReuseOfResetArrays) {
+  {
+    FastResetFlagArray<uint8_t> flags(20);
+    for (int i = 0; i < 300; ++i) {
+      flags.set(i % 20);
+      flags.reset();
+    }
+    flags.set(5);
+  }
+  FastResetFlagArray<uint8_t> flags(20);
+  for (size_t i = 0; i < 20; ++i) {
+    ASSERT_FALSE(flags[i]);
+  }
+}
+
+TEST_F(AScratchMemory, ProvidesEmptySparseSetsAndMapsAfterReuse) {
+  {
+    SparseSet<HypernodeID> set(20);
+    set.add(3);
+    set.add(7);
+    SparseMap<HypernodeID, Gain> map(20);
+    map[4] = 2;
+    map[9] = 3;
+  }
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(2));
+  SparseSet<HypernodeID> set(20);
+  SparseMap<HypernodeID, Gain> map(20);
+  ASSERT_THAT(ScratchMemory::instance().numFreeBlocks(), Eq(0));
+  ASSERT_THAT(set.size(), Eq(0));
+  ASSERT_THAT(map.size(), Eq(0));
+  for (HypernodeID i = 0; i < 20; ++i) {
+    ASSERT_FALSE(set.contains(i));
+    ASSERT_FALSE(map.contains(i));
+  }
+  map[9] += 1;
+  ASSERT_THAT(map.get(9), Eq(1));
+}
+}  // namespace ds
+}  // namespace kahypar
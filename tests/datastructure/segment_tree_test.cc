@@ -164,5 +164,30 @@ TEST_F(ASequence, SumOfPowersQuery) {
   check_query_result<SumOfPowers, naive_sum_of_powers>(sequence.size(), tree, sequence, 2);
 }
 
+TEST_F(ASequence, RangeMinimumQueryAfterUpdates) {
+  RangeMinimum tree(sequence, 0);
+  Randomize& random = Randomize::instance();
+  for (size_t i = 0; i < sequence.size(); ++i) {
+    const size_t pos = random.getRandomInt(0, sequence.size() - 1);
+    sequence[pos] = random.getRandomInt(0, 100);
+    tree.update(pos);
+  }
+  check_query_result<RangeMinimum, naive_min>(sequence.size(), tree, sequence, 0);
+}
+
+TEST_F(ASequence, FindsFirstElementSatisfyingAPredicate) {
+  RangeMinimum tree(sequence, 0);
+  for (int threshold = 0; threshold <= 100; threshold += 10) {
+    const auto below_threshold = [&](const int value) {
+                                   return value <= threshold;
+                                 };
+    size_t first = 0;
+    while (first < sequence.size() && !below_threshold(sequence[first])) {
+      ++first;
+    }
+    ASSERT_EQ(tree.findFirst(below_threshold), first);
+  }
+}
+
 }
 }
@@ -18,7 +18,10 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -302,6 +305,176 @@ TEST(KaHyPar, CanImprovePartitionsViaInterface) {
   kahypar_context_free(context);
 }
 
+struct ReportedSolutions {
+  std::vector<std::vector<kahypar_partition_id_t> > partitions;
+  std::vector<kahypar_hyperedge_weight_t> objectives;
+  kahypar_hypernode_id_t num_vertices;
+};
+
+static void recordImprovedSolution(const kahypar_partition_id_t* partition,
+                                   const kahypar_hyperedge_weight_t objective,
+                                   const double,
+                                   void* user_data) {
+  ReportedSolutions& solutions = *reinterpret_cast<ReportedSolutions*>(user_data);
+  solutions.partitions.emplace_back(partition, partition + solutions.num_vertices);
+  solutions.objectives.push_back(objective);
+}
+
+TEST(KaHyPar, ReportsImprovingSolutionsViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/km1_kKaHyPar_sea20.ini");
+
+  kahypar_hypergraph_t* kahypar_hypergraph =
+    kahypar_create_hypergraph_from_file("../../../tests/end_to_end/test_instances/ISPD98_ibm01.hgr", 4);
+  const kahypar_hypernode_id_t num_vertices =
+    reinterpret_cast<Hypergraph*>(kahypar_hypergraph)->initialNumNodes();
+
+  ReportedSolutions solutions;
+  solutions.num_vertices = num_vertices;
+  kahypar_set_improved_solution_callback(context, recordImprovedSolution, &solutions);
+
+  kahypar_hyperedge_weight_t objective = 0;
+  std::vector<kahypar_partition_id_t> partition(num_vertices, -1);
+  kahypar_partition_hypergraph(kahypar_hypergraph, 4, 0.03, &objective, context, partition.data());
+
+  ASSERT_FALSE(solutions.objectives.empty());
+  ASSERT_EQ(solutions.objectives.back(), objective);
+  ASSERT_THAT(solutions.partitions.back(), ContainerEq(partition));
+
+  kahypar_hypergraph_free(kahypar_hypergraph);
+  kahypar_context_free(context);
+}
+
+struct ReportedProgress {
+  std::vector<kahypar_progress_phase_t> phases;
+  bool cancel_during_uncoarsening;
+};
+
+static int recordProgress(const kahypar_progress_phase_t phase,
+                          const size_t,
+                          const kahypar_hypernode_id_t,
+                          const kahypar_hyperedge_weight_t,
+                          void* user_data) {
+  ReportedProgress& progress = *reinterpret_cast<ReportedProgress*>(user_data);
+  progress.phases.push_back(phase);
+  return progress.cancel_during_uncoarsening && phase == KAHYPAR_PROGRESS_UNCOARSENING;
+}
+
+TEST(KaHyPar, CanCancelPartitioningViaProgressCallback) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/km1_kKaHyPar_sea20.ini");
+
+  kahypar_hypergraph_t* kahypar_hypergraph =
+    kahypar_create_hypergraph_from_file("../../../tests/end_to_end/test_instances/ISPD98_ibm01.hgr", 4);
+  const kahypar_hypernode_id_t num_vertices =
+    reinterpret_cast<Hypergraph*>(kahypar_hypergraph)->initialNumNodes();
+
+  reinterpret_cast<kahypar::Context*>(context)->partition.soft_time_limit_check_frequency = 100;
+
+  ReportedProgress progress;
+  progress.cancel_during_uncoarsening = true;
+  kahypar_set_progress_callback(context, recordProgress, &progress);
+
+  kahypar_hyperedge_weight_t objective = 0;
+  std::vector<kahypar_partition_id_t> partition(num_vertices, -1);
+  kahypar_partition_hypergraph(kahypar_hypergraph, 4, 0.03, &objective, context, partition.data());
+
+  ASSERT_GT(std::count(progress.phases.begin(), progress.phases.end(),
+                       KAHYPAR_PROGRESS_COARSENING), 1);
+  ASSERT_EQ(std::count(progress.phases.begin(), progress.phases.end(),
+                       KAHYPAR_PROGRESS_INITIAL_PARTITIONING), 1);
+  // No further progress is reported after cancellation
+  ASSERT_EQ(progress.phases.back(), KAHYPAR_PROGRESS_UNCOARSENING);
+  ASSERT_EQ(std::count(progress.phases.begin(), progress.phases.end(),
+                       KAHYPAR_PROGRESS_UNCOARSENING), 1);
+  for (const kahypar_partition_id_t part : partition) {
+    ASSERT_GE(part, 0);
+    ASSERT_LT(part, 4);
+  }
+
+  // Cancellation only affects a single partitioning call
+  kahypar_hypergraph_free(kahypar_hypergraph);
+  kahypar_hypergraph =
+    kahypar_create_hypergraph_from_file("../../../tests/end_to_end/test_instances/ISPD98_ibm01.hgr", 4);
+  progress.phases.clear();
+  progress.cancel_during_uncoarsening = false;
+  kahypar_partition_hypergraph(kahypar_hypergraph, 4, 0.03, &objective, context, partition.data());
+
+  ASSERT_GT(std::count(progress.phases.begin(), progress.phases.end(),
+                       KAHYPAR_PROGRESS_UNCOARSENING), 1);
+
+  kahypar_hypergraph_free(kahypar_hypergraph);
+  kahypar_context_free(context);
+}
+
+TEST(KaHyPar, KeepsCancellationRequestsIssuedBeforeThePartitioningCall) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/km1_kKaHyPar_sea20.ini");
+
+  kahypar_hypergraph_t* kahypar_hypergraph =
+    kahypar_create_hypergraph_from_file("../../../tests/end_to_end/test_instances/ISPD98_ibm01.hgr", 4);
+  const kahypar_hypernode_id_t num_vertices =
+    reinterpret_cast<Hypergraph*>(kahypar_hypergraph)->initialNumNodes();
+
+  ReportedProgress progress;
+  progress.cancel_during_uncoarsening = false;
+  kahypar_set_progress_callback(context, recordProgress, &progress);
+
+  kahypar_cancel_partitioning(context);
+  kahypar_hyperedge_weight_t objective = 0;
+  std::vector<kahypar_partition_id_t> partition(num_vertices, -1);
+  kahypar_partition_hypergraph(kahypar_hypergraph, 4, 0.03, &objective, context, partition.data());
+
+  ASSERT_LE(std::count(progress.phases.begin(), progress.phases.end(),
+                       KAHYPAR_PROGRESS_UNCOARSENING), 1);
+  for (const kahypar_partition_id_t part : partition) {
+    ASSERT_GE(part, 0);
+    ASSERT_LT(part, 4);
+  }
+
+  kahypar_hypergraph_free(kahypar_hypergraph);
+  kahypar_context_free(context);
+}
+
+std::vector<kahypar_partition_id_t> partitionIBM01(const kahypar_partition_id_t k, const int seed) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/km1_kKaHyPar_sea20.ini");
+  reinterpret_cast<kahypar::Context*>(context)->partition.seed = seed;
+  reinterpret_cast<kahypar::Context*>(context)->partition.quiet_mode = true;
+
+  kahypar_hypergraph_t* kahypar_hypergraph =
+    kahypar_create_hypergraph_from_file("../../../tests/end_to_end/test_instances/ISPD98_ibm01.hgr", k);
+  std::vector<kahypar_partition_id_t> partition(
+    reinterpret_cast<Hypergraph*>(kahypar_hypergraph)->initialNumNodes(), -1);
+  kahypar_hyperedge_weight_t objective = 0;
+  kahypar_partition_hypergraph(kahypar_hypergraph, k, 0.03, &objective, context, partition.data());
+
+  kahypar_hypergraph_free(kahypar_hypergraph);
+  kahypar_context_free(context);
+  return partition;
+}
+
+TEST(KaHyPar, CanPartitionDistinctHypergraphsConcurrently) {
+  const std::vector<std::pair<kahypar_partition_id_t, int> > instances = { { 2, 1 }, { 4, 2 }, { 8, 3 } };
+  std::vector<std::vector<kahypar_partition_id_t> > partitions(instances.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < instances.size(); ++i) {
+    threads.emplace_back([&, i]() {
+        partitions[i] = partitionIBM01(instances[i].first, instances[i].second);
+      });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // Concurrent calls do not share any state, i.e., the results are
+  // the same as those of sequential calls with the same seeds.
+  for (size_t i = 0; i < instances.size(); ++i) {
+    ASSERT_THAT(partitions[i],
+                ::testing::ContainerEq(partitionIBM01(instances[i].first, instances[i].second)));
+  }
+}
+
 TEST(KaHyPar, CanCreateHypergraphsViaInterface) {
   const kahypar_hypernode_id_t num_vertices = 7;
   const kahypar_hyperedge_id_t num_hyperedges = 4;
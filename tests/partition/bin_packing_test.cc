@@ -239,6 +239,65 @@ TEST_F(Test, FirstFitLocked) {
   ASSERT_EQ(algorithm.binWeight(2), 5);
 }
 
+TEST_F(Test, BinTreeFirstFitEqualsLinearFirstFit) {
+  Randomize& random = Randomize::instance();
+  for (PartitionID num_bins : { 1, 2, 7, 64, 100 }) {
+    BinTreeFirstFit algorithm(num_bins, 20);
+    LinearFirstFit reference(num_bins, 20);
+    for (PartitionID bin = 0; bin < num_bins; ++bin) {
+      const HypernodeWeight initial_weight = random.getRandomInt(0, 10);
+      algorithm.addWeight(bin, initial_weight);
+      reference.addWeight(bin, initial_weight);
+    }
+    std::vector<bool> locked(num_bins, false);
+    PartitionID num_locked = 0;
+    for (int i = 0; i < 1000; ++i) {
+      const HypernodeWeight weight = random.getRandomInt(0, 8);
+      const PartitionID bin = algorithm.insertElement(weight);
+      ASSERT_EQ(bin, reference.insertElement(weight));
+      if (num_locked + 1 < num_bins && random.flipCoin()) {
+        const PartitionID to_lock = random.getRandomInt(0, num_bins - 1);
+        if (!locked[to_lock]) {
+          algorithm.lockBin(to_lock);
+          reference.lockBin(to_lock);
+          locked[to_lock] = true;
+          ++num_locked;
+        }
+      }
+    }
+    for (PartitionID bin = 0; bin < num_bins; ++bin) {
+      ASSERT_EQ(algorithm.binWeight(bin), reference.binWeight(bin));
+    }
+  }
+}
+
+TEST_F(Test, BinTreeFirstFitCanBeCopied) {
+  BinTreeFirstFit algorithm(3, 4);
+  algorithm.addWeight(0, 3);
+
+  BinTreeFirstFit copy(algorithm);
+  std::vector<BinTreeFirstFit> moved;
+  moved.push_back(std::move(algorithm));
+
+  ASSERT_EQ(copy.insertElement(2), 1);
+  ASSERT_EQ(moved[0].insertElement(2), 1);
+  ASSERT_EQ(moved[0].insertElement(1), 0);
+}
+
+TEST_F(BinPackingTest, HeavyNodesArePrefixOfDescendingOrder) {
+  initializeWeights({1, 5, 2, 5, 7, 1, 3, 2});
+
+  HypernodeWeight light_weight = 0;
+  const std::vector<HypernodeID> heavy = heavyNodesInDescendingWeightOrder(hypergraph, 2, light_weight);
+  const std::vector<HypernodeID> all = nodesInDescendingWeightOrder(hypergraph);
+
+  ASSERT_EQ(heavy.size(), 4);
+  for (size_t i = 0; i < heavy.size(); ++i) {
+    ASSERT_EQ(hypergraph.nodeWeight(heavy[i]), hypergraph.nodeWeight(all[i]));
+  }
+  ASSERT_EQ(light_weight, 6);
+}
+
 TEST_F(Test, PartitionMapping) {
   PartitionMapping mapping(3);
   std::vector<PartitionID> _parts { 0, 1, 2 };
@@ -25,6 +25,9 @@
 #include "kahypar/partition/coarsening/full_vertex_pair_coarsener.h"
 #include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/2way_fm_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
 #include "tests/partition/coarsening/vertex_pair_coarsener_test_fixtures.h"
 
 using ::testing::AllOf;
@@ -88,6 +91,10 @@ TEST_F(ACoarsener, DoesNotCoarsenUntilCoarseningLimit) {
   doesNotCoarsenUntilCoarseningLimit(coarsener, hypergraph, context);
 }
 
+TEST_F(ACoarsener, StopsCoarseningIfTimeLimitIsExceeded) {
+  stopsCoarseningIfTimeLimitIsExceeded(coarsener, hypergraph, context);
+}
+
 // accesses private coarsener internals and therefore cannot be extracted easily
 TEST_F(ACoarsener, SelectsNodePairToContractBasedOnHighestRating) {
   coarsener.coarsen(6);
@@ -122,6 +129,125 @@ TEST_F(ACoarsener, ReEvaluatesHypernodesWithNoIncidentEdges) {
   ASSERT_THAT(hypergraph.nodeIsEnabled(2), Eq(true));
 }
 
+class RefinementNodesRecorder final : public IRefiner {
+ public:
+  RefinementNodesRecorder() :
+    calls() {
+    _is_initialized = true;
+  }
+
+  std::vector<std::vector<HypernodeID> > calls;
+
+ private:
+  bool refineImpl(std::vector<HypernodeID>& refinement_nodes,
+                  const std::array<HypernodeWeight, 2>&,
+                  const UncontractionGainChanges&,
+                  Metrics&) override final {
+    calls.push_back(refinement_nodes);
+    return false;
+  }
+};
+
+static void assignAlternatingParts(Hypergraph& hypergraph) {
+  PartitionID part = 0;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, part);
+    part = 1 - part;
+  }
+  hypergraph.initializeNumCutHyperedges();
+}
+
+TEST_F(ACoarsener, PerformsOneLocalSearchPerUncontractionBatch) {
+  context.local_search.uncontraction_batch_size = 2;
+  coarsener.coarsen(2);
+  assignAlternatingParts(*hypergraph);
+
+  RefinementNodesRecorder recorder;
+  coarsener.uncoarsen(recorder);
+
+  // 5 uncontractions in batches of 2
+  ASSERT_THAT(recorder.calls.size(), Eq(3));
+  HypernodeID num_seeds = 0;
+  for (std::vector<HypernodeID>& nodes : recorder.calls) {
+    ASSERT_THAT(std::adjacent_find(nodes.begin(), nodes.end()), Eq(nodes.end()));
+    num_seeds += nodes.size();
+  }
+  ASSERT_THAT(num_seeds, AllOf(testing::Ge(7), testing::Le(10)));
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+}
+
+TEST_F(ACoarsener, KeepsTheTwoWayGainCacheValidDuringBatchedUncoarsening) {
+  context.local_search.algorithm = RefinementAlgorithm::twoway_fm;
+  context.local_search.fm.max_number_of_fruitless_moves = 50;
+  context.local_search.uncontraction_batch_size = 3;
+  coarsener.coarsen(2);
+  assignAlternatingParts(*hypergraph);
+  const HyperedgeWeight initial_cut = metrics::hyperedgeCut(*hypergraph);
+
+  // The refiner asserts the validity of its gain cache in debug builds.
+  TwoWayFMRefiner<NumberOfFruitlessMovesStopsSearch> fm_refiner(*hypergraph, context);
+  fm_refiner.initialize(100);
+  coarsener.uncoarsen(fm_refiner);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_THAT(metrics::hyperedgeCut(*hypergraph), Le(initial_cut));
+}
+
+TEST_F(ACoarsener, RefinesOnlyTheInputHypergraphInFastProjectionMode) {
+  context.local_search.fast_projection = true;
+  coarsener.coarsen(2);
+  assignAlternatingParts(*hypergraph);
+
+  RefinementNodesRecorder recorder;
+  coarsener.uncoarsen(recorder);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_THAT(recorder.calls.size(), Eq(1));
+  for (const HypernodeID& hn : recorder.calls[0]) {
+    ASSERT_THAT(hypergraph->isBorderNode(hn), Eq(true));
+  }
+  ASSERT_THAT(hypergraph->edgeSize(1), Eq(4));
+  ASSERT_THAT(hypergraph->edgeSize(3), Eq(3));
+}
+
+TEST_F(ACoarsener, ComputesThePartitionDataOfTheInputHypergraphInFastProjectionMode) {
+  context.local_search.fast_projection = true;
+  coarsener.coarsen(2);
+  assignAlternatingParts(*hypergraph);
+
+  RefinementNodesRecorder recorder;
+  coarsener.uncoarsen(recorder);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_THAT(hypergraph->partWeight(0) + hypergraph->partWeight(1), Eq(7));
+  ASSERT_THAT(hypergraph->partSize(0) + hypergraph->partSize(1), Eq(7));
+  for (const HyperedgeID& he : hypergraph->edges()) {
+    std::vector<HypernodeID> pin_counts(2, 0);
+    for (const HypernodeID& pin : hypergraph->pins(he)) {
+      ++pin_counts[hypergraph->partID(pin)];
+    }
+    ASSERT_THAT(hypergraph->pinCountInPart(he, 0), Eq(pin_counts[0]));
+    ASSERT_THAT(hypergraph->pinCountInPart(he, 1), Eq(pin_counts[1]));
+    ASSERT_THAT(hypergraph->connectivity(he),
+                Eq((pin_counts[0] > 0) + (pin_counts[1] > 0)));
+  }
+}
+
+TEST_F(ACoarsener, ProjectsThePartitionAndRefinesWithTwoWayFMInFastProjectionMode) {
+  context.local_search.algorithm = RefinementAlgorithm::twoway_fm;
+  context.local_search.fm.max_number_of_fruitless_moves = 50;
+  context.local_search.fast_projection = true;
+  coarsener.coarsen(2);
+  assignAlternatingParts(*hypergraph);
+  const HyperedgeWeight initial_cut = metrics::hyperedgeCut(*hypergraph);
+
+  TwoWayFMRefiner<NumberOfFruitlessMovesStopsSearch> fm_refiner(*hypergraph, context);
+  coarsener.uncoarsen(fm_refiner);
+
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_THAT(metrics::hyperedgeCut(*hypergraph), Le(initial_cut));
+}
+
 TEST(OurCoarsener, DoesNotObscureNaturalClustersInHypergraphs) {
   HyperedgeIndexVector index_vector;
   HyperedgeVector edge_vector;
@@ -85,6 +85,10 @@ TEST_F(ACoarsener, DoesNotCoarsenUntilCoarseningLimit) {
   doesNotCoarsenUntilCoarseningLimit(coarsener, hypergraph, context);
 }
 
+TEST_F(ACoarsener, StopsCoarseningIfTimeLimitIsExceeded) {
+  stopsCoarseningIfTimeLimitIsExceeded(coarsener, hypergraph, context);
+}
+
 TEST(ALazyUpdateCoarsener, InvalidatesAdjacentHypernodesInsteadOfReratingThem) {
   Hypergraph hypergraph(5, 2, HyperedgeIndexVector { 0, 2,  /*sentinel*/ 7 },
                         HyperedgeVector { 0, 1, 0, 1, 2, 3, 4 });
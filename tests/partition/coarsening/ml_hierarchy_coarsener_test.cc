@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2016 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/meta/registrar.h"
+#include "kahypar/partition/coarsening/ml_hierarchy_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/2way_fm_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+#include "tests/partition/coarsening/vertex_pair_coarsener_test_fixtures.h"
+
+namespace kahypar {
+using CoarsenerType = MLHierarchyCoarsener<HeavyEdgeScore,
+                                           MultiplicativePenalty,
+                                           UseCommunityStructure,
+                                           NormalPartitionPolicy,
+                                           BestRatingPreferringUnmatched<FirstRatingWins>,
+                                           AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                           RatingType>;
+
+// The refiners of the coarse levels are created via the refiner factory.
+using RefinerFactory = meta::Factory<RefinementAlgorithm,
+                                     IRefiner* (*)(Hypergraph&, const Context&)>;
+
+static meta::Registrar<RefinerFactory> register_do_nothing_refiner(
+  RefinementAlgorithm::do_nothing,
+  [](Hypergraph&, const Context&) -> IRefiner* {
+    return new DoNothingRefiner();
+  });
+
+static meta::Registrar<RefinerFactory> register_twoway_fm_refiner(
+  RefinementAlgorithm::twoway_fm,
+  [](Hypergraph& hypergraph, const Context& context) -> IRefiner* {
+    return new TwoWayFMRefiner<NumberOfFruitlessMovesStopsSearch>(hypergraph, context);
+  });
+
+class AMLHierarchyCoarsener : public ACoarsenerBase<CoarsenerType>{
+ public:
+  explicit AMLHierarchyCoarsener() :
+    ACoarsenerBase() {
+    context.local_search.algorithm = RefinementAlgorithm::do_nothing;
+  }
+
+  void assignAlternatingParts(Hypergraph& hg) {
+    PartitionID part = 0;
+    for (const HypernodeID& hn : hg.nodes()) {
+      hg.setNodePart(hn, part);
+      part = 1 - part;
+    }
+    hg.initializeNumCutHyperedges();
+  }
+};
+
+TEST_F(AMLHierarchyCoarsener, DoesNotModifyTheInputHypergraph) {
+  coarsener.coarsen(2);
+
+  ASSERT_THAT(coarsener.coarsestHypergraph(), ::testing::NotNull());
+  ASSERT_THAT(coarsener.coarsestHypergraph()->currentNumNodes(), ::testing::Lt(7));
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_THAT(hypergraph->currentNumEdges(), Eq(4));
+  ASSERT_THAT(hypergraph->currentNumPins(), Eq(12));
+}
+
+TEST_F(AMLHierarchyCoarsener, PreservesTheTotalNodeWeight) {
+  coarsener.coarsen(2);
+  ASSERT_THAT(coarsener.coarsestHypergraph()->totalWeight(), Eq(7));
+}
+
+TEST_F(AMLHierarchyCoarsener, MergesParallelAndRemovesSingleNodeHyperedges) {
+  coarsener.coarsen(2);
+  const Hypergraph& coarsest = *coarsener.coarsestHypergraph();
+
+  HyperedgeWeight total_edge_weight = 0;
+  std::vector<std::vector<HypernodeID> > pin_sets;
+  for (const HyperedgeID& he : coarsest.edges()) {
+    ASSERT_THAT(coarsest.edgeSize(he), ::testing::Ge(2));
+    std::vector<HypernodeID> pins(coarsest.pins(he).first, coarsest.pins(he).second);
+    std::sort(pins.begin(), pins.end());
+    ASSERT_THAT(std::find(pin_sets.begin(), pin_sets.end(), pins) == pin_sets.end(), Eq(true));
+    pin_sets.push_back(pins);
+    total_edge_weight += coarsest.edgeWeight(he);
+  }
+  ASSERT_THAT(total_edge_weight, Le(4));
+}
+
+TEST_F(AMLHierarchyCoarsener, ProjectsThePartitionWithoutChangingTheCut) {
+  coarsener.coarsen(2);
+  Hypergraph& coarsest = *coarsener.coarsestHypergraph();
+  assignAlternatingParts(coarsest);
+  const HyperedgeWeight coarse_cut = metrics::hyperedgeCut(coarsest);
+  const HyperedgeWeight coarse_km1 = metrics::km1(coarsest);
+
+  coarsener.uncoarsen(*refiner);
+
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_THAT(hypergraph->partID(hn), AnyOf(Eq(0), Eq(1)));
+  }
+  ASSERT_THAT(metrics::hyperedgeCut(*hypergraph), Eq(coarse_cut));
+  ASSERT_THAT(metrics::km1(*hypergraph), Eq(coarse_km1));
+}
+
+TEST_F(AMLHierarchyCoarsener, RefinesEachLevelWithTwoWayFM) {
+  context.local_search.algorithm = RefinementAlgorithm::twoway_fm;
+  context.local_search.fm.max_number_of_fruitless_moves = 50;
+  coarsener.coarsen(2);
+  Hypergraph& coarsest = *coarsener.coarsestHypergraph();
+  assignAlternatingParts(coarsest);
+  const HyperedgeWeight initial_cut = metrics::hyperedgeCut(coarsest);
+
+  TwoWayFMRefiner<NumberOfFruitlessMovesStopsSearch> fm_refiner(*hypergraph, context);
+  coarsener.uncoarsen(fm_refiner);
+
+  ASSERT_THAT(metrics::hyperedgeCut(*hypergraph), Le(initial_cut));
+}
+
+TEST_F(AMLHierarchyCoarsener, OnlyMatchesHypernodesOfTheSameBlockIfPartitioned) {
+  assignAlternatingParts(*hypergraph);
+  const HyperedgeWeight cut = metrics::hyperedgeCut(*hypergraph);
+  coarsener.coarsen(2);
+  Hypergraph& coarsest = *coarsener.coarsestHypergraph();
+
+  ASSERT_THAT(metrics::hyperedgeCut(coarsest), Eq(cut));
+  coarsener.uncoarsen(*refiner);
+  ASSERT_THAT(metrics::hyperedgeCut(*hypergraph), Eq(cut));
+}
+}  // namespace kahypar
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -275,4 +276,13 @@ void doesNotCoarsenUntilCoarseningLimit(Coarsener& coarsener, HypergraphT& hyper
   }
   ASSERT_THAT(hypergraph->currentNumNodes(), Eq(3));
 }
+
+template <class Coarsener, class HypergraphT, class Context>
+void stopsCoarseningIfTimeLimitIsExceeded(Coarsener& coarsener, HypergraphT& hypergraph, Context& context) {
+  context.partition.time_limit = 1;
+  context.partition.start_time = std::chrono::high_resolution_clock::now() - std::chrono::seconds(2);
+  coarsener.coarsen(2);
+  ASSERT_THAT(hypergraph->currentNumNodes(), Eq(7));
+  ASSERT_TRUE((*context.partition.time_limited_phases)[static_cast<size_t>(TimeLimitPhase::coarsening)]);
+}
 }  // namespace kahypar
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/evolutionary/checkpoint.h"
+#include "kahypar/partition/evolutionary/population.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/utils/randomize.h"
+
+using ::testing::ContainerEq;
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+class AnEvoCheckpointer : public Test {
+ public:
+  AnEvoCheckpointer() :
+    population(),
+    context(),
+    hypergraph(8, 5, HyperedgeIndexVector { 0, 2, 4, 7, 10,  /*sentinel*/ 15 },
+               HyperedgeVector { 0, 1, 4, 5, 1, 5, 6, 3, 6, 7, 0, 1, 2, 4, 5 }) {
+    hypergraph.changeK(3);
+    context.partition.k = 3;
+    context.partition.objective = Objective::km1;
+    context.partition.quiet_mode = true;
+    context.evolutionary.checkpoint_filename = "evo_checkpoint_test.checkpoint";
+    context.evolutionary.population_size = 2;
+    context.evolutionary.edge_frequency_amount = 1;
+    context.evolutionary.iteration = 42;
+    context.evolutionary.communities = { 0, 0, 0, 1, 1, 1, 2, 2 };
+    population.restoreIndividual(hypergraph, context, { 0, 0, 0, 1, 1, 1, 2, 2 });
+    population.restoreIndividual(hypergraph, context, { 2, 1, 0, 2, 1, 0, 2, 1 });
+  }
+
+  ~AnEvoCheckpointer() {
+    std::remove(context.evolutionary.checkpoint_filename.c_str());
+  }
+
+  Population population;
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(AnEvoCheckpointer, RestoresThePopulationAndTheEvolutionaryState) {
+  Randomize::instance().setSeed(7);
+  {
+    EvoCheckpointer checkpointer(context);
+    ASSERT_TRUE(checkpointer.write(hypergraph, context, population, 12.5));
+  }
+  const int expected_random_number = Randomize::instance().getRandomInt(0, 1000000);
+
+  Randomize::instance().setSeed(13);
+  Context resumed_context(context);
+  resumed_context.evolutionary.iteration = 0;
+  resumed_context.evolutionary.communities.clear();
+  EvoCheckpoint checkpoint;
+  ASSERT_TRUE(EvoCheckpointer::read(context.evolutionary.checkpoint_filename, hypergraph,
+                                    resumed_context, checkpoint));
+  Population resumed_population;
+  EvoCheckpointer::restore(hypergraph, resumed_context, resumed_population, checkpoint);
+
+  ASSERT_THAT(checkpoint.elapsed_time, Eq(12.5));
+  ASSERT_THAT(resumed_context.evolutionary.iteration, Eq(42));
+  ASSERT_THAT(resumed_context.evolutionary.communities,
+              ContainerEq(context.evolutionary.communities));
+  ASSERT_THAT(resumed_population.size(), Eq(population.size()));
+  for (size_t i = 0; i < population.size(); ++i) {
+    ASSERT_THAT(resumed_population.individualAt(i).partition(),
+                ContainerEq(population.individualAt(i).partition()));
+    ASSERT_THAT(resumed_population.individualAt(i).fitness(),
+                Eq(population.individualAt(i).fitness()));
+  }
+  ASSERT_THAT(Randomize::instance().getRandomInt(0, 1000000), Eq(expected_random_number));
+}
+
+TEST_F(AnEvoCheckpointer, RejectsCheckpointsOfOtherRuns) {
+  {
+    EvoCheckpointer checkpointer(context);
+    ASSERT_TRUE(checkpointer.write(hypergraph, context, population, 1.0));
+  }
+  Context other_context(context);
+  other_context.partition.k = 4;
+  EvoCheckpoint checkpoint;
+  ASSERT_FALSE(EvoCheckpointer::read(context.evolutionary.checkpoint_filename, hypergraph,
+                                     other_context, checkpoint));
+}
+
+TEST_F(AnEvoCheckpointer, RejectsCheckpointsWithALargerPopulation) {
+  {
+    EvoCheckpointer checkpointer(context);
+    ASSERT_TRUE(checkpointer.write(hypergraph, context, population, 1.0));
+  }
+  Context other_context(context);
+  other_context.evolutionary.population_size = 1;
+  other_context.evolutionary.dynamic_population_size = false;
+  EvoCheckpoint checkpoint;
+  ASSERT_FALSE(EvoCheckpointer::read(context.evolutionary.checkpoint_filename, hypergraph,
+                                     other_context, checkpoint));
+  ASSERT_TRUE(checkpoint.partitions.empty());
+}
+
+TEST_F(AnEvoCheckpointer, RejectsCheckpointsWithInvalidBlockIDs) {
+  {
+    EvoCheckpointer checkpointer(context);
+    ASSERT_TRUE(checkpointer.write(hypergraph, context, population, 1.0));
+  }
+  {
+    // The last byte is the block of the last hypernode of the last individual.
+    std::fstream file(context.evolutionary.checkpoint_filename,
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(-1, std::ios::end);
+    file.put(static_cast<char>(context.partition.k));
+  }
+  EvoCheckpoint checkpoint;
+  ASSERT_FALSE(EvoCheckpointer::read(context.evolutionary.checkpoint_filename, hypergraph,
+                                     context, checkpoint));
+}
+
+TEST_F(AnEvoCheckpointer, IsNotDueBeforeTheCheckpointInterval) {
+  context.evolutionary.checkpoint_interval = 3600;
+  EvoCheckpointer checkpointer(context);
+  ASSERT_FALSE(checkpointer.isDue());
+
+  context.evolutionary.checkpoint_filename.clear();
+  context.evolutionary.checkpoint_interval = 0;
+  EvoCheckpointer disabled_checkpointer(context);
+  ASSERT_FALSE(disabled_checkpointer.isDue());
+}
+}  // namespace kahypar
@@ -18,6 +18,9 @@
  * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
  *
 ******************************************************************************/
+#include <random>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 #include "kahypar/definitions.h"
@@ -100,6 +103,57 @@ TEST_F(FixedVertex, AssignmentToBestPartitionIfKm1IsObjective) {
                 hypergraph->partID(6) == 0));
 }
 
+HyperedgeWeight matchingWeight(const fixed_vertices::AdjacencyMatrix& graph,
+                               const fixed_vertices::Matching& matching) {
+  HyperedgeWeight weight = 0;
+  for (const auto& matched_edge : matching) {
+    weight += graph[matched_edge.first][matched_edge.second];
+  }
+  return weight;
+}
+
+TEST(SparseWeightedBipartiteMatching, HasSameWeightAsDenseMatching) {
+  std::mt19937 gen(42);
+  for (const PartitionID k : { 1, 2, 3, 8, 17, 32 }) {
+    for (const double density : { 0.05, 0.3, 1.0 }) {
+      // Small weights provoke many ties
+      std::uniform_int_distribution<HyperedgeWeight> weight_dist(1, 4);
+      std::bernoulli_distribution edge_dist(density);
+      fixed_vertices::AdjacencyMatrix dense_graph(k, std::vector<HyperedgeWeight>(k, 0));
+      fixed_vertices::SparseBipartiteGraph sparse_graph(k);
+      for (PartitionID i = 0; i < k; ++i) {
+        for (PartitionID j = 0; j < k; ++j) {
+          if (edge_dist(gen)) {
+            dense_graph[i][j] = weight_dist(gen);
+            sparse_graph[i].emplace_back(j, dense_graph[i][j]);
+          }
+        }
+      }
+
+      const fixed_vertices::Matching dense_matching =
+        fixed_vertices::findMaximumWeightedBipartiteMatching(dense_graph);
+      const fixed_vertices::Matching sparse_matching =
+        fixed_vertices::findMaximumWeightedBipartiteMatching(sparse_graph);
+
+      ASSERT_EQ(sparse_matching.size(), static_cast<size_t>(k));
+      ASSERT_TRUE(fixed_vertices::verify(sparse_matching, k));
+      ASSERT_EQ(matchingWeight(dense_graph, sparse_matching),
+                matchingWeight(dense_graph, dense_matching)) << V(k) << V(density);
+    }
+  }
+}
+
+TEST(SparseWeightedBipartiteMatching, PrefersHeavierAugmentingPaths) {
+  // Greedily matching L-vertex 0 to R-vertex 0 would prevent the optimal
+  // matching {(0,1), (1,0)} with weight 9 + 10.
+  fixed_vertices::SparseBipartiteGraph graph(2);
+  graph[0] = { { 0, 10 }, { 1, 9 } };
+  graph[1] = { { 0, 10 } };
+
+  const fixed_vertices::Matching matching = fixed_vertices::findMaximumWeightedBipartiteMatching(graph);
+
+  ASSERT_THAT(matching, ::testing::UnorderedElementsAre(std::make_pair(0, 1), std::make_pair(1, 0)));
+}
 
 TEST_F(FixedVertex, FlowSnapshotDoesNotContainFixedVertices) {
   // have to set manually, whereas fixed_vertices::partition already does that
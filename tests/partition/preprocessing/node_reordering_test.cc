@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/preprocessing/node_reordering.h"
+
+using ::testing::Eq;
+using ::testing::ElementsAre;
+using ::testing::Test;
+using ::testing::TestWithParam;
+using ::testing::Values;
+
+namespace kahypar {
+class ANodeReordering : public TestWithParam<NodeOrdering>{
+ public:
+  ANodeReordering() :
+    context(),
+    hypergraph(io::createHypergraphFromFile(
+                 std::string("test_instances/WeightedHypergraph.hgr"), 2)),
+    reordering() {
+    context.partition.k = 2;
+    context.preprocessing.node_ordering = GetParam();
+  }
+
+  std::vector<HypernodeID> sortedPins(const Hypergraph& hg, const HyperedgeID he) {
+    std::vector<HypernodeID> pins;
+    for (const HypernodeID& pin : hg.pins(he)) {
+      pins.push_back(pin);
+    }
+    std::sort(pins.begin(), pins.end());
+    return pins;
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+  NodeReordering reordering;
+};
+
+TEST_P(ANodeReordering, ComputesAPermutationOfTheHypernodes) {
+  Hypergraph reordered = reordering.buildReorderedHypergraph(hypergraph, context);
+
+  ASSERT_EQ(reordered.currentNumNodes(), hypergraph.currentNumNodes());
+  std::vector<HypernodeID> mapping = reordering.hnToReorderedHnMapping();
+  std::sort(mapping.begin(), mapping.end());
+  for (HypernodeID hn = 0; hn < mapping.size(); ++hn) {
+    ASSERT_EQ(mapping[hn], hn);
+  }
+}
+
+TEST_P(ANodeReordering, PreservesPinsAndWeights) {
+  Hypergraph reordered = reordering.buildReorderedHypergraph(hypergraph, context);
+  const std::vector<HypernodeID>& mapping = reordering.hnToReorderedHnMapping();
+
+  ASSERT_EQ(reordered.type(), hypergraph.type());
+  ASSERT_EQ(reordered.currentNumEdges(), hypergraph.currentNumEdges());
+  ASSERT_EQ(reordered.currentNumPins(), hypergraph.currentNumPins());
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_EQ(reordered.nodeWeight(mapping[hn]), hypergraph.nodeWeight(hn));
+    ASSERT_EQ(reordered.nodeDegree(mapping[hn]), hypergraph.nodeDegree(hn));
+  }
+
+  std::vector<std::pair<std::vector<HypernodeID>, HyperedgeWeight> > original_edges;
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    std::vector<HypernodeID> pins;
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      pins.push_back(mapping[pin]);
+    }
+    std::sort(pins.begin(), pins.end());
+    original_edges.emplace_back(pins, hypergraph.edgeWeight(he));
+  }
+  std::vector<std::pair<std::vector<HypernodeID>, HyperedgeWeight> > reordered_edges;
+  for (const HyperedgeID& he : reordered.edges()) {
+    reordered_edges.emplace_back(sortedPins(reordered, he), reordered.edgeWeight(he));
+  }
+  std::sort(original_edges.begin(), original_edges.end());
+  std::sort(reordered_edges.begin(), reordered_edges.end());
+  ASSERT_EQ(reordered_edges, original_edges);
+}
+
+TEST_P(ANodeReordering, SortsHyperedgesByTheirSmallestPin) {
+  Hypergraph reordered = reordering.buildReorderedHypergraph(hypergraph, context);
+
+  HypernodeID last_min_pin = 0;
+  for (const HyperedgeID& he : reordered.edges()) {
+    const std::vector<HypernodeID> pins = sortedPins(reordered, he);
+    ASSERT_GE(pins.front(), last_min_pin);
+    last_min_pin = pins.front();
+  }
+}
+
+TEST_P(ANodeReordering, PreservesFixedVertices) {
+  hypergraph.setFixedVertex(2, 1);
+  hypergraph.setFixedVertex(5, 0);
+
+  Hypergraph reordered = reordering.buildReorderedHypergraph(hypergraph, context);
+  const std::vector<HypernodeID>& mapping = reordering.hnToReorderedHnMapping();
+
+  ASSERT_EQ(reordered.numFixedVertices(), 2);
+  ASSERT_TRUE(reordered.isFixedVertex(mapping[2]));
+  ASSERT_EQ(reordered.fixedVertexPartID(mapping[2]), 1);
+  ASSERT_TRUE(reordered.isFixedVertex(mapping[5]));
+  ASSERT_EQ(reordered.fixedVertexPartID(mapping[5]), 0);
+}
+
+TEST_P(ANodeReordering, MapsThePartitionBackToTheInputHypergraph) {
+  Hypergraph reordered = reordering.buildReorderedHypergraph(hypergraph, context);
+  for (const HypernodeID& hn : reordered.nodes()) {
+    reordered.setNodePart(hn, hn % 2);
+  }
+
+  reordering.applyPartition(reordered, hypergraph);
+
+  const std::vector<HypernodeID>& mapping = reordering.hnToReorderedHnMapping();
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_EQ(hypergraph.partID(hn), static_cast<PartitionID>(mapping[hn] % 2));
+  }
+}
+
+TEST_P(ANodeReordering, IgnoresDisabledHyperedges) {
+  hypergraph.removeEdge(0);
+
+  Hypergraph reordered = reordering.buildReorderedHypergraph(hypergraph, context);
+
+  ASSERT_EQ(reordered.initialNumNodes(), hypergraph.currentNumNodes());
+  ASSERT_EQ(reordered.initialNumEdges(), hypergraph.currentNumEdges());
+}
+
+INSTANTIATE_TEST_CASE_P(InBFSAndDegreeOrder,
+                        ANodeReordering,
+                        Values(NodeOrdering::bfs, NodeOrdering::degree));
+
+TEST(BFSNodeReordering, NumbersConnectedComponentsConsecutively) {
+  // Connected components {0, 2, 4}, {1, 3} and {5}
+  Hypergraph hypergraph(6, 3, HyperedgeIndexVector { 0, 2, 4, 6 },
+                        HyperedgeVector { 0, 2, 1, 3, 2, 4 });
+  Context context;
+  context.partition.k = 2;
+  context.preprocessing.node_ordering = NodeOrdering::bfs;
+  NodeReordering reordering;
+
+  reordering.buildReorderedHypergraph(hypergraph, context);
+
+  // Each BFS starts at an unvisited hypernode of smallest degree
+  ASSERT_THAT(reordering.hnToReorderedHnMapping(), ElementsAre(3, 5, 2, 4, 1, 0));
+}
+
+TEST(DegreeNodeReordering, NumbersHypernodesByDecreasingDegree) {
+  Hypergraph hypergraph(4, 3, HyperedgeIndexVector { 0, 2, 4, 6 },
+                        HyperedgeVector { 0, 3, 1, 3, 1, 3 });
+  Context context;
+  context.partition.k = 2;
+  context.preprocessing.node_ordering = NodeOrdering::degree;
+  NodeReordering reordering;
+
+  reordering.buildReorderedHypergraph(hypergraph, context);
+
+  ASSERT_THAT(reordering.hnToReorderedHnMapping(), ElementsAre(2, 1, 3, 0));
+}
+}  // namespace kahypar
@@ -90,4 +90,30 @@ TEST_F(AKwayFMRefiner, KnowsIfAHyperedgeIsFullyActive) {
   refiner->fullUpdate(0, 0, 1, 0);
   ASSERT_THAT(refiner->_he_fully_active[0], Eq(true));
 }
+
+TEST(ARollbackElement, StoresPartAndActionInOneWord) {
+  const RollbackElement element(42, 12345, -7, RollbackAction::do_nothing);
+
+  ASSERT_EQ(sizeof(RollbackElement), 12);
+  ASSERT_EQ(element.hn, 42);
+  ASSERT_EQ(element.part(), 12345);
+  ASSERT_EQ(element.delta, -7);
+  ASSERT_EQ(element.action(), RollbackAction::do_nothing);
+  ASSERT_EQ(RollbackElement(0, 0, 0, RollbackAction::do_add).action(), RollbackAction::do_add);
+  ASSERT_EQ(RollbackElement(0, 3, 0, RollbackAction::do_remove).part(), 3);
+}
+
+TEST_F(AKwayFMRefiner, OnlyKeepsMovesSinceTheLastImprovement) {
+  refiner->_performed_moves.push_back(RollbackInfo { 0, 0 });
+  hypergraph->changeNodePart(0, 0, 1);
+  refiner->commitPerformedMoves();
+  refiner->_performed_moves.push_back(RollbackInfo { 1, 1 });
+  hypergraph->changeNodePart(1, 1, 0);
+
+  refiner->rollback();
+
+  ASSERT_THAT(hypergraph->partID(0), Eq(1));
+  ASSERT_THAT(hypergraph->partID(1), Eq(1));
+  ASSERT_TRUE(refiner->_performed_moves.empty());
+}
 }  // namespace kahypar
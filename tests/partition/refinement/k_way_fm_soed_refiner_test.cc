@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+
+using ::testing::Test;
+using ::testing::Eq;
+
+namespace kahypar {
+using KWaySOEDRefinerSimpleStopping = KWaySOEDRefiner<NumberOfFruitlessMovesStopsSearch>;
+
+class AKWaySOEDRefiner : public Test {
+ public:
+  AKWaySOEDRefiner() :
+    context(),
+    hypergraph(),
+    refiner() { }
+
+  void setUpContext(const PartitionID k, const double epsilon) {
+    context.local_search.fm.max_number_of_fruitless_moves = 50;
+    context.partition.k = k;
+    context.partition.rb_lower_k = 0;
+    context.partition.rb_upper_k = context.partition.k - 1;
+    context.partition.epsilon = epsilon;
+    context.partition.mode = Mode::direct_kway;
+    context.partition.objective = Objective::soed;
+    for (PartitionID part = 0; part < k; ++part) {
+      context.partition.perfect_balance_part_weights.push_back(
+        ceil(hypergraph->totalWeight() / static_cast<double>(context.partition.k)));
+      context.partition.max_part_weights.push_back(
+        (1 + context.partition.epsilon) * context.partition.perfect_balance_part_weights[0]);
+    }
+  }
+
+  void setUpIBM01(const PartitionID k) {
+    hypergraph = std::make_unique<Hypergraph>(
+      io::createHypergraphFromFile(std::string("test_instances/ibm01.hgr"), k));
+    setUpContext(k, 0.03);
+    for (const HypernodeID& hn : hypergraph->nodes()) {
+      hypergraph->setNodePart(hn, hn % k);
+    }
+    hypergraph->initializeNumCutHyperedges();
+    refiner = std::make_unique<KWaySOEDRefinerSimpleStopping>(*hypergraph, context);
+    refiner->initialize(100);
+  }
+
+  bool refine(Metrics& metrics) {
+    std::vector<HypernodeID> refinement_nodes;
+    for (const HypernodeID& hn : hypergraph->nodes()) {
+      refinement_nodes.push_back(hn);
+    }
+    UncontractionGainChanges changes;
+    changes.representative.push_back(0);
+    changes.contraction_partner.push_back(0);
+    return refiner->refine(refinement_nodes, { context.partition.max_part_weights[0],
+                                               context.partition.max_part_weights[1] },
+                           changes, metrics);
+  }
+
+  Context context;
+  std::unique_ptr<Hypergraph> hypergraph;
+  std::unique_ptr<KWaySOEDRefinerSimpleStopping> refiner;
+};
+
+TEST_F(AKWaySOEDRefiner, ComputesSoedGainOfHypernodeMovement) {
+  // Moving HN 0 to block 1 does not change km1 (e1 becomes internal,
+  // e2 is cut into three blocks), but removes the cut net e1.
+  hypergraph = std::make_unique<Hypergraph>(4, 2, HyperedgeIndexVector { 0, 2,  /*sentinel*/ 5 },
+                                            HyperedgeVector { 0, 1, 0, 2, 3 }, 3);
+  setUpContext(3, 1.0);
+  hypergraph->setNodePart(0, 0);
+  hypergraph->setNodePart(1, 1);
+  hypergraph->setNodePart(2, 0);
+  hypergraph->setNodePart(3, 2);
+  hypergraph->initializeNumCutHyperedges();
+  refiner = std::make_unique<KWaySOEDRefinerSimpleStopping>(*hypergraph, context);
+  refiner->initialize(100);
+
+  ASSERT_THAT(refiner->gainInducedByHypergraph(0, 1), Eq(1));
+  ASSERT_THAT(refiner->gainInducedByHypergraph(0, 2), Eq(0));
+  ASSERT_THAT(refiner->gainInducedByHypergraph(1, 0), Eq(2));
+  ASSERT_THAT(refiner->_gain_cache.entry(0, 1), Eq(1));
+  ASSERT_THAT(refiner->_gain_cache.entry(0, 2), Eq(0));
+  ASSERT_THAT(refiner->_gain_cache.entry(1, 0), Eq(2));
+}
+
+TEST_F(AKWaySOEDRefiner, ReducesSoedAndKeepsCutAndKm1UpToDate) {
+  setUpIBM01(4);
+  Metrics metrics = { metrics::hyperedgeCut(*hypergraph),
+                      metrics::km1(*hypergraph),
+                      metrics::imbalance(*hypergraph, context) };
+  const HyperedgeWeight initial_soed = metrics::soed(*hypergraph);
+
+  ASSERT_TRUE(refine(metrics));
+
+  ASSERT_THAT(metrics.cut, Eq(metrics::hyperedgeCut(*hypergraph)));
+  ASSERT_THAT(metrics.km1, Eq(metrics::km1(*hypergraph)));
+  ASSERT_THAT(metrics.cut + metrics.km1, Eq(metrics::soed(*hypergraph)));
+  ASSERT_LT(metrics::soed(*hypergraph), initial_soed);
+}
+
+TEST_F(AKWaySOEDRefiner, MaintainsCorrectGainsDuringLocalSearch) {
+  setUpIBM01(8);
+  Metrics metrics = { metrics::hyperedgeCut(*hypergraph),
+                      metrics::km1(*hypergraph),
+                      metrics::imbalance(*hypergraph, context) };
+  refine(metrics);
+  refine(metrics);
+
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    for (const PartitionID& part : refiner->_gain_cache.adjacentParts(hn)) {
+      ASSERT_THAT(refiner->_gain_cache.entry(hn, part),
+                  Eq(refiner->gainInducedByHypergraph(hn, part)));
+    }
+  }
+}
+}  // namespace kahypar
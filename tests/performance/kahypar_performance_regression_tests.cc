@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/application/command_line_options.h"
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/kahypar.h"
+#include "kahypar/partitioner_facade.h"
+#include "kahypar/utils/memory.h"
+#include "kahypar/utils/timer.h"
+
+namespace kahypar {
+namespace pt = boost::property_tree;
+
+// Runs the sea20 configurations on a pinned set of instances and compares
+// per-phase running times and peak memory consumption against the baseline
+// stored in performance_baseline.json. A run fails if it has no baseline, if
+// any phase takes longer than baseline * (1 + relative) + absolute_seconds or
+// if its peak RSS exceeds baseline * (1 + memory_relative).
+//
+// Each run explicitly sets the local search algorithm. The sea20 configurations
+// are run both with their flow-based refiners, which pin the flow_refinement
+// phase, and with their FM-only variants.
+//
+// The measurements of all runs are written to performance_results.json in the
+// same format as the baseline. Since the budgets are absolute timings, they are
+// only meaningful for release builds on the host the baseline was recorded on.
+// To pin a new baseline on the CI host, build in Release mode and run
+//   make update_performance_baseline
+// which runs all tests and copies performance_results.json to
+// tests/performance/performance_baseline.json.
+class APerformanceRegressionTest : public ::testing::Test {
+  using Measurement = std::vector<std::pair<std::string, double> >;
+
+ public:
+  APerformanceRegressionTest() :
+    baseline() {
+    std::ifstream file(kBaselineFile);
+    if (file.good()) {
+      pt::read_json(file, baseline);
+    }
+  }
+
+  static constexpr const char* kBaselineFile = "performance_baseline.json";
+  static constexpr const char* kResultFile = "performance_results.json";
+
+  void run(const std::string& config, const RefinementAlgorithm algorithm,
+           const std::string& instance, const PartitionID k) {
+    Context context;
+    parseIniToContext(context, "../../../config/" + config + ".ini");
+    context.local_search.algorithm = algorithm;
+    context.partition.k = k;
+    context.partition.epsilon = 0.03;
+    context.partition.seed = 1;
+    context.partition.quiet_mode = true;
+    context.partition.graph_filename = "test_instances/" + instance;
+
+    Hypergraph hypergraph(
+      kahypar::io::createHypergraphFromFile(context.partition.graph_filename,
+                                            context.partition.k));
+
+    Timer::instance().clear();
+    memory::resetPeakRSS();
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    PartitionerFacade().partition(hypergraph, context);
+    const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+
+    const auto& timings = Timer::instance().result();
+    const Measurement measurement = {
+      { "preprocessing", timings.total_preprocessing },
+      { "coarsening", timings.total_coarsening },
+      { "initial_partitioning", timings.total_initial_partitioning },
+      { "local_search", timings.total_local_search },
+      { "flow_refinement", timings.total_flow_refinement },
+      { "total", std::chrono::duration<double>(end - start).count() },
+      { "peak_rss_mb", static_cast<double>(memory::peakRSS()) / (1024.0 * 1024.0) }
+    };
+
+    std::stringstream name;
+    name << config << ":" << algorithm << ":" << instance << ":k" << k;
+    record(name.str(), measurement);
+    compare(name.str(), measurement);
+  }
+
+ private:
+  double tolerance(const std::string& key) const {
+    return baseline.get<double>("tolerances." + key);
+  }
+
+  void record(const std::string& name, const Measurement& measurement) {
+    static std::map<std::string, Measurement> results;
+    results[name] = measurement;
+
+    std::ofstream file(kResultFile);
+    file << "{\n    \"tolerances\": {\n";
+    file << "        \"relative\": " << baseline.get("tolerances.relative", 0.25) << ",\n";
+    file << "        \"absolute_seconds\": " << baseline.get("tolerances.absolute_seconds", 0.1) << ",\n";
+    file << "        \"memory_relative\": " << baseline.get("tolerances.memory_relative", 0.15) << "\n";
+    file << "    },\n    \"runs\": {";
+    for (auto run = results.begin(); run != results.end(); ++run) {
+      file << (run == results.begin() ? "\n" : ",\n") << "        \"" << run->first << "\": {";
+      for (size_t i = 0; i < run->second.size(); ++i) {
+        file << (i == 0 ? "\n" : ",\n") << "            \"" << run->second[i].first << "\": "
+             << std::fixed << std::setprecision(3) << run->second[i].second;
+      }
+      file << "\n        }";
+    }
+    file << "\n    }\n}\n";
+  }
+
+  void compare(const std::string& name, const Measurement& measurement) {
+    const auto expected = baseline.get_child_optional(pt::ptree::path_type("runs/" + name, '/'));
+    ASSERT_TRUE(expected) << "No performance baseline for " << name << " in " << kBaselineFile
+                          << " (measurements were written to " << kResultFile << ")";
+    const double relative = tolerance("relative");
+    const double absolute = tolerance("absolute_seconds");
+    const double memory_relative = tolerance("memory_relative");
+
+    for (const auto& phase : measurement) {
+      const auto expected_value = expected->get_optional<double>(phase.first);
+      ASSERT_TRUE(expected_value) << name << ": no baseline for " << phase.first;
+      const double allowed = phase.first == "peak_rss_mb" ?
+                             *expected_value * (1.0 + memory_relative) :
+                             *expected_value * (1.0 + relative) + absolute;
+      EXPECT_LE(phase.second, allowed) << name << ": " << phase.first << " regressed ("
+                                       << "baseline=" << *expected_value << ", "
+                                       << "measured=" << phase.second << ")";
+    }
+  }
+
+  pt::ptree baseline;
+};
+
+TEST_F(APerformanceRegressionTest, Km1DirectKway) {
+  run("km1_kKaHyPar_sea20", RefinementAlgorithm::kway_fm_km1, "ISPD98_ibm01.hgr", 8);
+  run("km1_kKaHyPar_sea20", RefinementAlgorithm::kway_fm_km1, "bundle1.mtx.hgr", 8);
+}
+
+TEST_F(APerformanceRegressionTest, Km1DirectKwayWithFlows) {
+  run("km1_kKaHyPar_sea20", RefinementAlgorithm::kway_fm_hyperflow_cutter_km1,
+      "ISPD98_ibm01.hgr", 8);
+  run("km1_kKaHyPar_sea20", RefinementAlgorithm::kway_fm_hyperflow_cutter_km1,
+      "bundle1.mtx.hgr", 8);
+}
+
+TEST_F(APerformanceRegressionTest, Km1RecursiveBisectionWithFlows) {
+  run("km1_rKaHyPar_sea20", RefinementAlgorithm::twoway_fm_hyperflow_cutter,
+      "ISPD98_ibm01.hgr", 8);
+  run("km1_rKaHyPar_sea20", RefinementAlgorithm::twoway_fm_hyperflow_cutter,
+      "bundle1.mtx.hgr", 8);
+}
+
+TEST_F(APerformanceRegressionTest, Km1DirectKwayEco) {
+  run("km1_kKaHyPar_eco_sea20", RefinementAlgorithm::kway_fm_km1, "ISPD98_ibm01.hgr", 8);
+  run("km1_kKaHyPar_eco_sea20", RefinementAlgorithm::kway_fm_km1, "bundle1.mtx.hgr", 8);
+}
+
+TEST_F(APerformanceRegressionTest, Km1RecursiveBisection) {
+  run("km1_rKaHyPar_sea20", RefinementAlgorithm::twoway_fm, "ISPD98_ibm01.hgr", 8);
+  run("km1_rKaHyPar_sea20", RefinementAlgorithm::twoway_fm, "bundle1.mtx.hgr", 8);
+}
+
+TEST_F(APerformanceRegressionTest, CutDirectKway) {
+  run("cut_kKaHyPar_sea20", RefinementAlgorithm::kway_fm, "ISPD98_ibm01.hgr", 8);
+  run("cut_kKaHyPar_sea20", RefinementAlgorithm::kway_fm, "bundle1.mtx.hgr", 8);
+}
+
+TEST_F(APerformanceRegressionTest, CutRecursiveBisection) {
+  run("cut_rKaHyPar_sea20", RefinementAlgorithm::twoway_fm, "ISPD98_ibm01.hgr", 8);
+  run("cut_rKaHyPar_sea20", RefinementAlgorithm::twoway_fm, "bundle1.mtx.hgr", 8);
+}
+}  // namespace kahypar
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/utils/perf_counters.h"
+
+using ::testing::Eq;
+using ::testing::Gt;
+
+namespace kahypar {
+TEST(AScopedPerfCounter, DoesNotRecordValuesIfCountersAreDisabled) {
+  PerfCounters::instance().disable();
+  PerfCounters::instance().clear();
+  {
+    ScopedPerfCounter counter(PerfRegion::rating);
+  }
+  ASSERT_THAT(PerfCounters::instance().values(PerfRegion::rating).calls, Eq(0));
+}
+
+TEST(AScopedPerfCounter, DoesNotRecordValuesIfInactive) {
+  PerfCounters::instance().enable();
+  {
+    ScopedPerfCounter counter(PerfRegion::coarsening, false);
+  }
+  PerfCounters::instance().disable();
+  ASSERT_THAT(PerfCounters::instance().values(PerfRegion::coarsening).calls, Eq(0));
+}
+
+TEST(AScopedPerfCounter, RecordsInstructionsOfEnclosedCode) {
+  if (!PerfCounters::instance().enable()) {
+    // not built with KAHYPAR_ENABLE_PERF_COUNTERS or not permitted by the kernel
+    return;
+  }
+  volatile uint64_t sum = 0;
+  for (size_t i = 0; i < 2; ++i) {
+    ScopedPerfCounter counter(PerfRegion::fm_moves);
+    for (uint64_t j = 0; j < 100000; ++j) {
+      sum = sum + j;
+    }
+  }
+  PerfCounters::instance().disable();
+  const PerfCounterValues& values = PerfCounters::instance().values(PerfRegion::fm_moves);
+  ASSERT_THAT(values.calls, Eq(2));
+  ASSERT_THAT(values.instructions, Gt(100000));
+  ASSERT_THAT(values.cycles, Gt(0));
+}
+}  // namespace kahypar
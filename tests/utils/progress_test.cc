@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/partition/context.h"
+#include "kahypar/utils/progress.h"
+#include "kahypar/utils/time_limit.h"
+
+namespace kahypar {
+TEST(ACancellationRequest, OnlyAffectsThePartitioningCallOfItsContext) {
+  Context context;
+  Context copy(context);
+  progress::beginPartitioningCall(context);
+  progress::beginPartitioningCall(copy);
+
+  progress::requestCancellation(context);
+
+  ASSERT_TRUE(progress::isCancellationRequested(context));
+  ASSERT_FALSE(progress::isCancellationRequested(copy));
+}
+
+TEST(ACancellationRequest, IsSharedWithSubContextsOfThePartitioningCall) {
+  Context context;
+  progress::beginPartitioningCall(context);
+  const Context sub_context(context);
+
+  progress::requestCancellation(context);
+
+  ASSERT_TRUE(progress::isCancellationRequested(sub_context));
+}
+
+TEST(ACancellationRequest, IsKeptUntilThePartitioningCallStarts) {
+  Context context;
+  progress::requestCancellation(context);
+
+  progress::beginPartitioningCall(context);
+
+  ASSERT_TRUE(progress::isCancellationRequested(context));
+}
+
+TEST(ACancellationRequest, IsNotCopiedOutsideOfAPartitioningCall) {
+  Context context;
+  progress::requestCancellation(context);
+
+  const Context copy(context);
+
+  ASSERT_FALSE(progress::isCancellationRequested(copy));
+}
+
+TEST(ACancellationRequest, IsResetWhenThePartitioningCallFinishes) {
+  Context context;
+  progress::beginPartitioningCall(context);
+  progress::requestCancellation(context);
+
+  progress::endPartitioningCall(context);
+
+  ASSERT_FALSE(progress::isCancellationRequested(context));
+}
+
+TEST(ACancellationRequest, CutsEvolutionaryAndRepeatedPartitioningCallsShort) {
+  Context context;
+  context.partition_evolutionary = true;
+  context.partition.time_limited_repeated_partitioning = true;
+  progress::beginPartitioningCall(context);
+  ASSERT_FALSE(time_limit::isTimeLimitExceeded(context, TimeLimitPhase::local_search));
+
+  progress::requestCancellation(context);
+
+  ASSERT_TRUE(time_limit::isTimeLimitExceeded(context, TimeLimitPhase::local_search));
+  ASSERT_TRUE(time_limit::isSoftTimeLimitExceeded(context, 1));
+}
+}  // namespace kahypar
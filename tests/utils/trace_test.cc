@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2021 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "kahypar/utils/trace.h"
+
+using ::testing::Eq;
+using ::testing::HasSubstr;
+
+namespace kahypar {
+TEST(TraceArgs, FormatsNumbersAndBooleansAsJSONLiterals) {
+  ASSERT_THAT(TraceArgs().add("nodes", 42).add("block", -1).release(),
+              Eq("\"nodes\":42,\"block\":-1"));
+}
+
+TEST(TraceArgs, QuotesAndEscapesNonArithmeticValues) {
+  ASSERT_THAT(TraceArgs().add("algo", "a\"b\\c").add("improved", true).release(),
+              Eq("\"algo\":\"a\\\"b\\\\c\",\"improved\":true"));
+}
+
+TEST(AScopedTrace, DoesNotRecordEventsIfTracingIsDisabled) {
+  Tracer::instance().enable();
+  Tracer::instance().disable();
+  {
+    ScopedTrace trace("disabled", "test");
+    trace.arg("key", 1);
+  }
+  ASSERT_THAT(Tracer::instance().numEvents(), Eq(0));
+}
+
+TEST(AScopedTrace, RecordsExactlyOneEventIfStoppedExplicitly) {
+  Tracer::instance().enable();
+  {
+    ScopedTrace trace("enabled", "test");
+    trace.arg("key", 1).stop();
+  }
+  Tracer::instance().disable();
+  ASSERT_THAT(Tracer::instance().numEvents(), Eq(1));
+}
+
+TEST(ATracer, WritesCompleteEventsInChromeTraceFormat) {
+  Tracer::instance().enable();
+  {
+    ScopedTrace outer("outer", "test");
+    ScopedTrace inner("inner", "test");
+    inner.arg("level", 3);
+  }
+  Tracer::instance().disable();
+  Tracer::instance().writeChromeTrace("test_trace.json");
+
+  std::ifstream file("test_trace.json");
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string trace = buffer.str();
+  ASSERT_THAT(trace, HasSubstr("\"traceEvents\":["));
+  ASSERT_THAT(trace, HasSubstr("{\"name\":\"inner\",\"cat\":\"test\",\"ph\":\"X\""));
+  ASSERT_THAT(trace, HasSubstr("\"args\":{\"level\":3}}"));
+  ASSERT_THAT(trace, HasSubstr("{\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"X\""));
+  ASSERT_THAT(trace, HasSubstr("\"args\":{}}"));
+}
+}  // namespace kahypar